@@ -0,0 +1,694 @@
+"""
+Local stand-in for the OpenAI, Anthropic, DeepSeek and XAI APIs, for offline and deterministic load tests of the plugin.
+
+THIS FILE RUNS OUTSIDE THE UNREAL ENGINE SCOPE, it only needs the Python standard library.
+
+    python mock_provider_server.py --port 8080 --latency-ms 300 --tokens-per-second 80 --failure-rate 0.02
+
+Then start the editor or game with -GenAIBaseUrl=http://127.0.0.1:8080 (or set the Endpoints overrides in the plugin
+settings) and any non-empty API key, and every chat class talks to this server instead of the providers.
+"GenAI.Bench.Load" in the Unreal console drives a load test through it.
+
+Implemented:
+    POST /v1/chat/completions              OpenAI and XAI chat, streamed or not, json_object / json_schema outputs
+    POST /chat/completions                 DeepSeek chat, deepseek-reasoner adds reasoning_content
+    POST /v1/messages                      Anthropic messages, streamed or not
+    POST /v1/files, /v1/batches, ...       OpenAI batches, they complete after --batch-seconds
+    POST /v1/messages/batches, ...         Anthropic message batches
+    HEAD /                                 Connection warm-up pings
+    GET  /mock/stats                       Request counters
+    POST /mock/config                      Changes any of the options below at runtime, e.g. {"failure_rate": 0.5}
+    POST /mock/reset                       Resets the counters and the rate limit window
+
+Responses are deterministic: the text depends only on the request body, and injected failures follow --seed in arrival order.
+"""
+
+import argparse
+import gzip
+import hashlib
+import json
+import random
+import re
+import threading
+import time
+import uuid
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import urlparse
+
+
+WORDS = [
+    "the", "a", "quick", "small", "ancient", "glowing", "sword", "shield", "potion", "forest", "castle", "dragon",
+    "merchant", "travels", "guards", "whispers", "under", "over", "through", "bright", "dark", "river", "stone",
+    "village", "knight", "carries", "old", "map", "toward", "mountain", "and", "with", "quietly", "storm", "gold",
+]
+
+
+class MockConfig:
+    """Behaviour of the server, every field can be changed through POST /mock/config"""
+
+    def __init__(self, args):
+        self.latency_ms = args.latency_ms
+        self.jitter_ms = args.jitter_ms
+        self.tokens_per_second = args.tokens_per_second
+        self.response_tokens = args.response_tokens
+        self.failure_rate = args.failure_rate
+        self.rate_limit_rate = args.rate_limit_rate
+        self.stream_abort_rate = args.stream_abort_rate
+        self.retry_after = args.retry_after
+        self.rpm = args.rpm
+        self.tpm = args.tpm
+        self.batch_seconds = args.batch_seconds
+        self.gzip_responses = args.gzip_responses
+        self.require_api_key = not args.no_auth
+        self.quiet = args.quiet
+
+    def update(self, values):
+        for key, value in values.items():
+            if not hasattr(self, key):
+                raise KeyError(key)
+            current = getattr(self, key)
+            if isinstance(current, bool) and not isinstance(value, bool):
+                value = str(value).lower() in ("1", "true", "yes")
+            setattr(self, key, type(current)(value))
+
+    def to_dict(self):
+        return dict(self.__dict__)
+
+
+class MockState:
+    """Counters, the rate limit window and batches, shared by all handler threads"""
+
+    def __init__(self, config, seed):
+        self.config = config
+        self.seed = seed
+        self.lock = threading.Lock()
+        self.reset()
+        self.files = {}
+        self.batches = {}
+
+    def reset(self):
+        with self.lock:
+            self.random = random.Random(self.seed)
+            self.window_start = time.monotonic()
+            self.window_requests = 0
+            self.window_tokens = 0
+            self.stats = {
+                "requests": 0, "streamed": 0, "succeeded": 0, "failed": 0, "rate_limited": 0, "stream_aborts": 0,
+                "unauthorized": 0, "bad_requests": 0, "in_flight": 0, "max_in_flight": 0,
+                "output_tokens": 0, "bytes_received": 0, "bytes_sent": 0,
+            }
+
+    def count(self, key, amount=1):
+        with self.lock:
+            self.stats[key] += amount
+
+    def enter(self):
+        with self.lock:
+            self.stats["requests"] += 1
+            self.stats["in_flight"] += 1
+            self.stats["max_in_flight"] = max(self.stats["max_in_flight"], self.stats["in_flight"])
+
+    def leave(self):
+        with self.lock:
+            self.stats["in_flight"] -= 1
+
+    def roll(self):
+        """Next value of the seeded failure injection sequence"""
+        with self.lock:
+            return self.random.random()
+
+    def take_rate_limit(self, tokens):
+        """Returns (allowed, limit headers) for a one minute fixed window, 0 rpm / tpm disables either limit"""
+        config = self.config
+        with self.lock:
+            now = time.monotonic()
+            if now - self.window_start >= 60.0:
+                self.window_start = now
+                self.window_requests = 0
+                self.window_tokens = 0
+            reset = max(0.0, 60.0 - (now - self.window_start))
+
+            allowed = (config.rpm <= 0 or self.window_requests < config.rpm) and \
+                      (config.tpm <= 0 or self.window_tokens + tokens <= config.tpm)
+            if allowed:
+                self.window_requests += 1
+                self.window_tokens += tokens
+
+            headers = {}
+            if config.rpm > 0:
+                headers["x-ratelimit-limit-requests"] = str(config.rpm)
+                headers["x-ratelimit-remaining-requests"] = str(max(0, config.rpm - self.window_requests))
+                headers["x-ratelimit-reset-requests"] = f"{reset:.3f}s"
+            if config.tpm > 0:
+                headers["x-ratelimit-limit-tokens"] = str(config.tpm)
+                headers["x-ratelimit-remaining-tokens"] = str(max(0, config.tpm - self.window_tokens))
+                headers["x-ratelimit-reset-tokens"] = f"{reset:.3f}s"
+            if not allowed:
+                headers["retry-after"] = str(max(1, int(reset + 0.999)))
+            return allowed, headers
+
+
+# --- Content generation --------------------------------------------------------------------------
+
+def body_rng(body):
+    return random.Random(int.from_bytes(hashlib.sha256(body).digest()[:8], "little"))
+
+
+def make_tokens(rng, count):
+    tokens = []
+    for index in range(count):
+        word = rng.choice(WORDS)
+        tokens.append(word.capitalize() if index == 0 else " " + word)
+    if tokens:
+        tokens[-1] += "."
+    return tokens
+
+
+def estimate_tokens(value):
+    """Rough prompt size, about four characters per token like the real tokenizers"""
+    return max(1, len(json.dumps(value)) // 4)
+
+
+def instance_from_schema(schema, rng, depth=0):
+    """Smallest instance that validates against the common subset of JSON schema used for structured outputs"""
+    if not isinstance(schema, dict) or depth > 8:
+        return None
+    if "enum" in schema and schema["enum"]:
+        return schema["enum"][rng.randrange(len(schema["enum"]))]
+    if "const" in schema:
+        return schema["const"]
+    for key in ("anyOf", "oneOf", "allOf"):
+        if schema.get(key):
+            return instance_from_schema(schema[key][0], rng, depth + 1)
+
+    schema_type = schema.get("type", "object")
+    if isinstance(schema_type, list):
+        schema_type = next((entry for entry in schema_type if entry != "null"), "null")
+
+    if schema_type == "object":
+        properties = schema.get("properties", {})
+        return {name: instance_from_schema(value, rng, depth + 1) for name, value in properties.items()}
+    if schema_type == "array":
+        count = max(schema.get("minItems", 0), 2)
+        return [instance_from_schema(schema.get("items", {}), rng, depth + 1) for _ in range(count)]
+    if schema_type == "string":
+        return " ".join(rng.choice(WORDS) for _ in range(3))
+    if schema_type == "integer":
+        return rng.randint(schema.get("minimum", 0), schema.get("maximum", 100))
+    if schema_type == "number":
+        return round(rng.uniform(schema.get("minimum", 0), schema.get("maximum", 100)), 2)
+    if schema_type == "boolean":
+        return rng.random() < 0.5
+    return None
+
+
+def structured_text(request, rng, token_count):
+    """JSON answer for response_format requests, None for free text"""
+    response_format = request.get("response_format") or {}
+    if response_format.get("type") == "json_schema":
+        schema = (response_format.get("json_schema") or {}).get("schema", {})
+        return json.dumps(instance_from_schema(schema, rng))
+    if response_format.get("type") == "json_object":
+        return json.dumps({"response": "".join(make_tokens(rng, token_count))})
+    return None
+
+
+def split_text(text, chunk_chars=4):
+    return [text[index:index + chunk_chars] for index in range(0, len(text), chunk_chars)] or [""]
+
+
+# --- Request handler -----------------------------------------------------------------------------
+
+class MockProviderHandler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    server_version = "GenAIMockProvider/1.0"
+    state = None
+
+    def log_message(self, format, *args):
+        if not self.state.config.quiet:
+            super().log_message(format, *args)
+
+    # HTTP plumbing
+
+    def read_body(self):
+        length = int(self.headers.get("Content-Length") or 0)
+        body = self.rfile.read(length) if length > 0 else b""
+        self.state.count("bytes_received", len(body))
+        if self.headers.get("Content-Encoding", "").lower() == "gzip":
+            body = gzip.decompress(body)
+        return body
+
+    def send_bytes(self, status, body, content_type="application/json", headers=None):
+        if self.state.config.gzip_responses and "gzip" in self.headers.get("Accept-Encoding", "") and len(body) > 256:
+            body = gzip.compress(body)
+            headers = dict(headers or {}, **{"Content-Encoding": "gzip"})
+        self.send_response(status)
+        self.send_header("Content-Type", content_type)
+        self.send_header("Content-Length", str(len(body)))
+        for name, value in (headers or {}).items():
+            self.send_header(name, value)
+        self.end_headers()
+        if self.command != "HEAD":
+            self.wfile.write(body)
+        self.state.count("bytes_sent", len(body))
+
+    def send_json(self, status, value, headers=None):
+        self.send_bytes(status, json.dumps(value).encode("utf-8"), headers=headers)
+
+    def send_error_json(self, status, message, error_type, anthropic, headers=None):
+        if anthropic:
+            payload = {"type": "error", "error": {"type": error_type, "message": message}}
+        else:
+            payload = {"error": {"message": message, "type": error_type, "param": None, "code": error_type}}
+        self.send_json(status, payload, headers)
+
+    def begin_stream(self, headers):
+        self.send_response(200)
+        self.send_header("Content-Type", "text/event-stream")
+        self.send_header("Cache-Control", "no-cache")
+        self.send_header("Transfer-Encoding", "chunked")
+        for name, value in headers.items():
+            self.send_header(name, value)
+        self.end_headers()
+
+    def write_chunk(self, data):
+        self.wfile.write(f"{len(data):x}\r\n".encode("ascii") + data + b"\r\n")
+        self.wfile.flush()
+        self.state.count("bytes_sent", len(data))
+
+    def write_event(self, data, event=None):
+        text = (f"event: {event}\n" if event else "") + f"data: {data if isinstance(data, str) else json.dumps(data)}\n\n"
+        self.write_chunk(text.encode("utf-8"))
+
+    def end_stream(self):
+        self.wfile.write(b"0\r\n\r\n")
+        self.wfile.flush()
+
+    def abort_stream(self):
+        """Drops the connection without the terminating chunk, like a provider or proxy failing mid-response"""
+        self.state.count("stream_aborts")
+        self.close_connection = True
+        self.connection.shutdown(2)
+        return False
+
+    # Routing
+
+    def do_HEAD(self):
+        self.send_bytes(200, b"", content_type="text/plain")
+
+    def do_GET(self):
+        path = urlparse(self.path).path
+        if path == "/mock/stats":
+            with self.state.lock:
+                stats = dict(self.state.stats)
+            return self.send_json(200, {"stats": stats, "config": self.state.config.to_dict()})
+
+        match = re.fullmatch(r"/v1/batches/([^/]+)", path)
+        if match:
+            return self.openai_batch_status(match.group(1))
+        match = re.fullmatch(r"/v1/files/([^/]+)/content", path)
+        if match:
+            return self.openai_file_content(match.group(1))
+        match = re.fullmatch(r"/v1/messages/batches/([^/]+)", path)
+        if match:
+            return self.anthropic_batch_status(match.group(1))
+        match = re.fullmatch(r"/v1/messages/batches/([^/]+)/results", path)
+        if match:
+            return self.anthropic_batch_results(match.group(1))
+        self.send_error_json(404, f"Unknown path {path}", "not_found_error", path.startswith("/v1/messages"))
+
+    def do_POST(self):
+        path = urlparse(self.path).path
+        body = self.read_body()
+
+        if path == "/mock/config":
+            try:
+                self.state.config.update(json.loads(body or b"{}"))
+            except (KeyError, ValueError) as error:
+                return self.send_json(400, {"error": {"message": f"Unknown or invalid option {error}"}})
+            return self.send_json(200, self.state.config.to_dict())
+        if path == "/mock/reset":
+            self.state.reset()
+            return self.send_json(200, {"ok": True})
+
+        if path in ("/v1/chat/completions", "/chat/completions"):
+            return self.handle_chat(body, anthropic=False)
+        if path == "/v1/messages":
+            return self.handle_chat(body, anthropic=True)
+
+        if path == "/v1/files":
+            return self.openai_upload_file(body)
+        if path == "/v1/batches":
+            return self.openai_create_batch(body)
+        match = re.fullmatch(r"/v1/batches/([^/]+)/cancel", path)
+        if match:
+            return self.cancel_batch(match.group(1), anthropic=False)
+        if path == "/v1/messages/batches":
+            return self.anthropic_create_batch(body)
+        match = re.fullmatch(r"/v1/messages/batches/([^/]+)/cancel", path)
+        if match:
+            return self.cancel_batch(match.group(1), anthropic=True)
+        self.send_error_json(404, f"Unknown path {path}", "not_found_error", path.startswith("/v1/messages"))
+
+    # Chat
+
+    def has_api_key(self, anthropic):
+        if not self.state.config.require_api_key:
+            return True
+        if anthropic:
+            return bool(self.headers.get("x-api-key"))
+        return self.headers.get("Authorization", "").startswith("Bearer ") and len(self.headers["Authorization"]) > 7
+
+    def handle_chat(self, body, anthropic):
+        state, config = self.state, self.state.config
+        state.enter()
+        try:
+            if not self.has_api_key(anthropic):
+                state.count("unauthorized")
+                return self.send_error_json(401, "Missing API key", "authentication_error", anthropic)
+            try:
+                request = json.loads(body)
+            except ValueError:
+                state.count("bad_requests")
+                return self.send_error_json(400, "Request body is not valid JSON", "invalid_request_error", anthropic)
+            if not isinstance(request.get("messages"), list) or not request.get("model"):
+                state.count("bad_requests")
+                return self.send_error_json(400, "model and messages are required", "invalid_request_error", anthropic)
+
+            prompt_tokens = estimate_tokens(request.get("messages")) + (estimate_tokens(request["system"]) if "system" in request else 0)
+            max_tokens = request.get("max_completion_tokens") or request.get("max_tokens") or config.response_tokens
+            output_tokens = max(1, min(config.response_tokens, int(max_tokens)))
+
+            allowed, limit_headers = state.take_rate_limit(prompt_tokens + output_tokens)
+            if not allowed or state.roll() < config.rate_limit_rate:
+                state.count("rate_limited")
+                limit_headers.setdefault("retry-after", str(config.retry_after))
+                error_type = "rate_limit_error" if anthropic else "rate_limit_exceeded"
+                return self.send_error_json(429, "Rate limit reached, retry later", error_type, anthropic, limit_headers)
+            if state.roll() < config.failure_rate:
+                state.count("failed")
+                error_type = "overloaded_error" if anthropic else "server_error"
+                return self.send_error_json(529 if anthropic else 500, "Injected server failure", error_type, anthropic, limit_headers)
+
+            # Time to first byte
+            time.sleep(max(0.0, config.latency_ms + state.roll() * 2.0 * config.jitter_ms - config.jitter_ms) / 1000.0)
+
+            rng = body_rng(body)
+            text = structured_text(request, rng, output_tokens)
+            pieces = split_text(text) if text is not None else make_tokens(rng, output_tokens)
+            reasoning = make_tokens(rng, max(1, output_tokens // 2)) if request["model"] == "deepseek-reasoner" else []
+            usage = {"prompt_tokens": prompt_tokens, "output_tokens": output_tokens}
+
+            if request.get("stream"):
+                state.count("streamed")
+                if anthropic:
+                    completed = self.stream_anthropic(request, pieces, usage, limit_headers)
+                else:
+                    completed = self.stream_chat_completions(request, pieces, reasoning, usage, limit_headers)
+                if not completed:
+                    return
+            else:
+                # Non-streamed answers still take as long as generating them would
+                if config.tokens_per_second > 0:
+                    time.sleep(output_tokens / config.tokens_per_second)
+                if anthropic:
+                    self.send_json(200, self.anthropic_message(request, "".join(pieces), usage), limit_headers)
+                else:
+                    self.send_json(200, self.chat_completion(request, "".join(pieces), "".join(reasoning), usage), limit_headers)
+            state.count("succeeded")
+            state.count("output_tokens", output_tokens)
+        except (BrokenPipeError, ConnectionResetError):
+            # The client cancelled the request
+            self.close_connection = True
+        finally:
+            state.leave()
+
+    def pace(self, pieces_per_token=1.0):
+        tokens_per_second = self.state.config.tokens_per_second
+        if tokens_per_second > 0:
+            time.sleep(1.0 / (tokens_per_second * pieces_per_token))
+
+    def should_abort_stream(self, index, count):
+        return index == count // 2 and self.state.config.stream_abort_rate > 0 and self.state.roll() < self.state.config.stream_abort_rate
+
+    @staticmethod
+    def chat_completion(request, text, reasoning, usage):
+        message = {"role": "assistant", "content": text, "refusal": None}
+        if reasoning:
+            message["reasoning_content"] = reasoning
+        return {
+            "id": "chatcmpl-" + uuid.uuid4().hex[:24],
+            "object": "chat.completion",
+            "created": int(time.time()),
+            "model": request["model"],
+            "choices": [{"index": 0, "message": message, "finish_reason": "stop"}],
+            "usage": {
+                "prompt_tokens": usage["prompt_tokens"],
+                "completion_tokens": usage["output_tokens"],
+                "total_tokens": usage["prompt_tokens"] + usage["output_tokens"],
+                "prompt_tokens_details": {"cached_tokens": 0},
+            },
+        }
+
+    @staticmethod
+    def anthropic_message(request, text, usage):
+        return {
+            "id": "msg_" + uuid.uuid4().hex[:24],
+            "type": "message",
+            "role": "assistant",
+            "model": request["model"],
+            "content": [{"type": "text", "text": text}],
+            "stop_reason": "end_turn",
+            "stop_sequence": None,
+            "usage": {
+                "input_tokens": usage["prompt_tokens"],
+                "output_tokens": usage["output_tokens"],
+                "cache_creation_input_tokens": 0,
+                "cache_read_input_tokens": 0,
+            },
+        }
+
+    def stream_chat_completions(self, request, pieces, reasoning, usage, headers):
+        completion_id = "chatcmpl-" + uuid.uuid4().hex[:24]
+        created = int(time.time())
+
+        def chunk(delta, finish_reason=None):
+            return {"id": completion_id, "object": "chat.completion.chunk", "created": created, "model": request["model"],
+                    "choices": [{"index": 0, "delta": delta, "finish_reason": finish_reason}]}
+
+        self.begin_stream(headers)
+        self.write_event(chunk({"role": "assistant", "content": ""}))
+        for piece in reasoning:
+            self.pace()
+            self.write_event(chunk({"content": None, "reasoning_content": piece}))
+        for index, piece in enumerate(pieces):
+            if self.should_abort_stream(index, len(pieces)):
+                return self.abort_stream()
+            self.pace(len(pieces) / max(1, usage["output_tokens"]))
+            self.write_event(chunk({"content": piece}))
+        self.write_event(chunk({}, "stop"))
+        # Like the real API, streamed usage is only reported when asked for
+        if (request.get("stream_options") or {}).get("include_usage"):
+            self.write_event({"id": completion_id, "object": "chat.completion.chunk", "created": created, "model": request["model"],
+                              "choices": [], "usage": {"prompt_tokens": usage["prompt_tokens"], "completion_tokens": usage["output_tokens"],
+                                                       "total_tokens": usage["prompt_tokens"] + usage["output_tokens"]}})
+        self.write_event("[DONE]")
+        self.end_stream()
+        return True
+
+    def stream_anthropic(self, request, pieces, usage, headers):
+        message = self.anthropic_message(request, "", {"prompt_tokens": usage["prompt_tokens"], "output_tokens": 1})
+        message["content"] = []
+        message["stop_reason"] = None
+
+        self.begin_stream(headers)
+        self.write_event({"type": "message_start", "message": message}, "message_start")
+        self.write_event({"type": "content_block_start", "index": 0, "content_block": {"type": "text", "text": ""}}, "content_block_start")
+        self.write_event({"type": "ping"}, "ping")
+        for index, piece in enumerate(pieces):
+            if self.should_abort_stream(index, len(pieces)):
+                return self.abort_stream()
+            self.pace(len(pieces) / max(1, usage["output_tokens"]))
+            self.write_event({"type": "content_block_delta", "index": 0, "delta": {"type": "text_delta", "text": piece}}, "content_block_delta")
+        self.write_event({"type": "content_block_stop", "index": 0}, "content_block_stop")
+        self.write_event({"type": "message_delta", "delta": {"stop_reason": "end_turn", "stop_sequence": None},
+                          "usage": {"output_tokens": usage["output_tokens"]}}, "message_delta")
+        self.write_event({"type": "message_stop"}, "message_stop")
+        self.end_stream()
+        return True
+
+    # Batches
+
+    def batch_answer(self, body):
+        """Non-streamed answer to one batched request, no latency or failure injection"""
+        encoded = json.dumps(body, sort_keys=True).encode("utf-8")
+        rng = body_rng(encoded)
+        output_tokens = max(1, min(self.state.config.response_tokens, int(body.get("max_completion_tokens") or body.get("max_tokens") or 64)))
+        text = structured_text(body, rng, output_tokens)
+        if text is None:
+            text = "".join(make_tokens(rng, output_tokens))
+        return text, {"prompt_tokens": estimate_tokens(body.get("messages")), "output_tokens": output_tokens}
+
+    def refresh_batch(self, batch):
+        """Completes the batch once --batch-seconds have passed since it was created"""
+        if batch["state"] == "in_progress" and time.time() - batch["created_at"] >= self.state.config.batch_seconds:
+            batch["state"] = "ended"
+            lines = []
+            for custom_id, body in batch["requests"]:
+                text, usage = self.batch_answer(body)
+                if batch["anthropic"]:
+                    result = {"type": "succeeded", "message": self.anthropic_message(body, text, usage)}
+                    lines.append(json.dumps({"custom_id": custom_id, "result": result}))
+                else:
+                    response = {"status_code": 200, "request_id": uuid.uuid4().hex, "body": self.chat_completion(body, text, "", usage)}
+                    lines.append(json.dumps({"id": "batch_req_" + uuid.uuid4().hex[:16], "custom_id": custom_id, "response": response, "error": None}))
+            output = ("\n".join(lines) + "\n").encode("utf-8")
+            if batch["anthropic"]:
+                batch["results"] = output
+            else:
+                batch["output_file_id"] = self.store_file(output)
+
+    def store_file(self, content):
+        file_id = "file-" + uuid.uuid4().hex[:24]
+        with self.state.lock:
+            self.state.files[file_id] = content
+        return file_id
+
+    def openai_upload_file(self, body):
+        # multipart/form-data, the jsonl is the part named "file"
+        match = re.search(rb'name="file"[^\r\n]*\r\n(?:[^\r\n]+\r\n)*\r\n(.*?)\r\n--', body, re.S)
+        if not match:
+            return self.send_error_json(400, "No file part in upload", "invalid_request_error", False)
+        file_id = self.store_file(match.group(1))
+        self.send_json(200, {"id": file_id, "object": "file", "bytes": len(match.group(1)), "purpose": "batch", "created_at": int(time.time())})
+
+    def openai_create_batch(self, body):
+        request = json.loads(body or b"{}")
+        with self.state.lock:
+            content = self.state.files.get(request.get("input_file_id"))
+        if content is None:
+            return self.send_error_json(404, "Unknown input_file_id", "invalid_request_error", False)
+        requests = []
+        for line in content.decode("utf-8").splitlines():
+            if line.strip():
+                item = json.loads(line)
+                requests.append((item["custom_id"], item["body"]))
+        self.send_json(200, self.openai_batch_object(self.create_batch(requests, anthropic=False)))
+
+    def anthropic_create_batch(self, body):
+        if not self.has_api_key(True):
+            return self.send_error_json(401, "Missing API key", "authentication_error", True)
+        request = json.loads(body or b"{}")
+        requests = [(item["custom_id"], item["params"]) for item in request.get("requests", [])]
+        self.send_json(200, self.anthropic_batch_object(self.create_batch(requests, anthropic=True)))
+
+    def create_batch(self, requests, anthropic):
+        batch = {"id": ("msgbatch_" if anthropic else "batch_") + uuid.uuid4().hex[:24], "anthropic": anthropic, "requests": requests,
+                 "created_at": time.time(), "state": "in_progress", "cancelled": False}
+        with self.state.lock:
+            self.state.batches[batch["id"]] = batch
+        return batch
+
+    def find_batch(self, batch_id, anthropic):
+        with self.state.lock:
+            batch = self.state.batches.get(batch_id)
+        if batch is None:
+            self.send_error_json(404, f"Unknown batch {batch_id}", "not_found_error", anthropic)
+            return None
+        self.refresh_batch(batch)
+        return batch
+
+    def cancel_batch(self, batch_id, anthropic):
+        batch = self.find_batch(batch_id, anthropic)
+        if batch is None:
+            return
+        if batch["state"] == "in_progress":
+            batch["state"] = "ended"
+            batch["cancelled"] = True
+            if anthropic:
+                batch["results"] = "".join(json.dumps({"custom_id": custom_id, "result": {"type": "canceled"}}) + "\n"
+                                           for custom_id, _ in batch["requests"]).encode("utf-8")
+        self.send_json(200, self.anthropic_batch_object(batch) if anthropic else self.openai_batch_object(batch))
+
+    def openai_batch_object(self, batch):
+        status = "in_progress" if batch["state"] == "in_progress" else ("cancelled" if batch["cancelled"] else "completed")
+        count = len(batch["requests"])
+        return {"id": batch["id"], "object": "batch", "endpoint": "/v1/chat/completions", "status": status,
+                "output_file_id": batch.get("output_file_id"), "error_file_id": None, "created_at": int(batch["created_at"]),
+                "request_counts": {"total": count, "completed": count if status == "completed" else 0, "failed": 0}}
+
+    def anthropic_batch_object(self, batch):
+        ended = batch["state"] == "ended"
+        host = self.headers.get("Host", f"127.0.0.1:{self.server.server_address[1]}")
+        count = len(batch["requests"])
+        return {"id": batch["id"], "type": "message_batch", "processing_status": "ended" if ended else "in_progress",
+                "results_url": f"http://{host}/v1/messages/batches/{batch['id']}/results" if ended else None,
+                "request_counts": {"processing": 0 if ended else count, "succeeded": 0 if batch["cancelled"] or not ended else count,
+                                   "errored": 0, "canceled": count if batch["cancelled"] else 0, "expired": 0}}
+
+    def openai_batch_status(self, batch_id):
+        batch = self.find_batch(batch_id, False)
+        if batch is not None:
+            self.send_json(200, self.openai_batch_object(batch))
+
+    def anthropic_batch_status(self, batch_id):
+        batch = self.find_batch(batch_id, True)
+        if batch is not None:
+            self.send_json(200, self.anthropic_batch_object(batch))
+
+    def openai_file_content(self, file_id):
+        with self.state.lock:
+            content = self.state.files.get(file_id)
+        if content is None:
+            return self.send_error_json(404, f"Unknown file {file_id}", "invalid_request_error", False)
+        self.send_bytes(200, content, content_type="application/jsonl")
+
+    def anthropic_batch_results(self, batch_id):
+        batch = self.find_batch(batch_id, True)
+        if batch is None:
+            return
+        if "results" not in batch:
+            return self.send_error_json(409, "Batch has not ended yet", "invalid_request_error", True)
+        self.send_bytes(200, batch["results"], content_type="application/binary")
+
+
+class MockProviderServer(ThreadingHTTPServer):
+    daemon_threads = True
+    # Load tests open many connections at once
+    request_queue_size = 1024
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Local stand-in for the LLM provider APIs used by the GenerativeAISupport plugin")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--latency-ms", type=float, default=200.0, help="Time to first byte")
+    parser.add_argument("--jitter-ms", type=float, default=50.0, help="Uniform +- jitter on the latency")
+    parser.add_argument("--tokens-per-second", type=float, default=100.0, help="Generation speed, 0 answers instantly")
+    parser.add_argument("--response-tokens", type=int, default=64, help="Answer length, capped by the request's max tokens")
+    parser.add_argument("--failure-rate", type=float, default=0.0, help="Share of requests failing with 500 (529 for Anthropic)")
+    parser.add_argument("--rate-limit-rate", type=float, default=0.0, help="Share of requests rejected with 429 on top of --rpm / --tpm")
+    parser.add_argument("--stream-abort-rate", type=float, default=0.0, help="Share of streams whose connection drops halfway")
+    parser.add_argument("--retry-after", type=int, default=1, help="retry-after seconds sent with injected 429s")
+    parser.add_argument("--rpm", type=int, default=0, help="Requests per minute before 429s, 0 is unlimited")
+    parser.add_argument("--tpm", type=int, default=0, help="Tokens per minute before 429s, 0 is unlimited")
+    parser.add_argument("--batch-seconds", type=float, default=5.0, help="How long a batch stays in progress")
+    parser.add_argument("--gzip-responses", action="store_true", help="gzip non-streamed responses when the client accepts it")
+    parser.add_argument("--no-auth", action="store_true", help="Accept requests without an API key")
+    parser.add_argument("--seed", type=int, default=0, help="Seed of the failure injection sequence")
+    parser.add_argument("--quiet", action="store_true", help="Do not log every request")
+    args = parser.parse_args()
+
+    MockProviderHandler.state = MockState(MockConfig(args), args.seed)
+    server = MockProviderServer((args.host, args.port), MockProviderHandler)
+    print(f"Mock provider server listening on http://{args.host}:{args.port}, start Unreal with -GenAIBaseUrl=http://{args.host}:{args.port}")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        server.server_close()
+
+
+if __name__ == "__main__":
+    main()
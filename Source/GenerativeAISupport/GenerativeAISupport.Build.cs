@@ -29,8 +29,16 @@ public class GenerativeAISupport : ModuleRules
 			new string[]
 			{
 				"Slate",
-				"SlateCore"
+				"SlateCore",
+				"JsonUtilities",
+				"Projects"
 			}
 		);
+
+		// Tokenizer vocab files are read from disk, not through the asset system
+		RuntimeDependencies.Add("$(PluginDir)/Content/Tokenizers/*.tiktoken", StagedFileType.UFS);
+
+		// Request / response body compression
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
 	}
 }
\ No newline at end of file
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Data/GenCancellationToken.h"
+
+FGenCancellationToken FGenCancellationToken::Create()
+{
+	FGenCancellationToken Token;
+	Token.State = MakeShared<FState>();
+	return Token;
+}
+
+void FGenCancellationToken::Cancel() const
+{
+	if (!State.IsValid() || State->bCancelled)
+	{
+		return;
+	}
+	State->bCancelled = true;
+
+	// Keeps the state alive while the callbacks unregister themselves
+	const TSharedPtr<FState> Pinned = State;
+	Pinned->OnCancelled.Broadcast();
+	Pinned->OnCancelled.Clear();
+}
+
+FDelegateHandle FGenCancellationToken::AddOnCancelled(FSimpleDelegate Callback) const
+{
+	if (!State.IsValid() || State->bCancelled)
+	{
+		return FDelegateHandle();
+	}
+	return State->OnCancelled.Add(MoveTemp(Callback));
+}
+
+void FGenCancellationToken::RemoveOnCancelled(FDelegateHandle Handle) const
+{
+	if (State.IsValid() && Handle.IsValid())
+	{
+		State->OnCancelled.Remove(Handle);
+	}
+}
+
+FGenCancellationToken UGenCancellationLibrary::MakeCancellationToken()
+{
+	return FGenCancellationToken::Create();
+}
+
+void UGenCancellationLibrary::CancelToken(const FGenCancellationToken& Token)
+{
+	Token.Cancel();
+}
+
+bool UGenCancellationLibrary::IsTokenCancelled(const FGenCancellationToken& Token)
+{
+	return Token.IsCancelled();
+}
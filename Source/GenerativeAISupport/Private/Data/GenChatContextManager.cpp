@@ -0,0 +1,341 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Data/GenChatContextManager.h"
+
+#include "Network/GenProviderTraits.h"
+#include "Secure/GenSecureKey.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenTrace.h"
+#include "Utilities/GenUtils.h"
+
+namespace
+{
+	const TCHAR* SummaryInstructions = TEXT(
+		"You keep the memory of a long conversation. Merge the earlier summary and the new transcript into one concise summary, "
+		"written in the language of the conversation. Keep names, facts, decisions, promises and open threads, drop small talk. "
+		"Reply with the summary only.");
+
+	// Failed summaries of the same turns before they are given up on
+	constexpr int32 MaxSummaryAttempts = 3;
+
+	// Trimmed turns waiting for a summary, the oldest are dropped beyond it
+	constexpr int32 MaxPendingSummaryTurns = 64;
+
+	FString MakeSummaryMessage(const FString& Summary)
+	{
+		return TEXT("Summary of the conversation so far: ") + Summary;
+	}
+}
+
+UGenChatContextManager* UGenChatContextManager::CreateChatContextManager(const FGenContextPolicy& Policy)
+{
+	UGenChatContextManager* Manager = NewObject<UGenChatContextManager>();
+	Manager->Policy = Policy;
+	return Manager;
+}
+
+void UGenChatContextManager::SetPolicy(const FGenContextPolicy& InPolicy)
+{
+	const bool bRecount = InPolicy.Encoding != Policy.Encoding;
+	Policy = InPolicy;
+	if (bRecount)
+	{
+		for (FTurn& Turn : Pinned)
+		{
+			Turn.Tokens = CountMessageTokens(Turn.Message.Role, Turn.Message.Content);
+		}
+		for (FTurn& Turn : Turns)
+		{
+			Turn.Tokens = CountMessageTokens(Turn.Message.Role, Turn.Message.Content);
+		}
+	}
+	RebuildPrefix();
+	RebuildWindow();
+	EnforceBudget();
+}
+
+void UGenChatContextManager::AddMessage(const FString& Role, const FString& Content)
+{
+	if (Policy.bPinSystemMessages && Role == TEXT("system"))
+	{
+		PinMessage(Role, Content);
+		return;
+	}
+
+	FTurn& Turn = Turns.AddDefaulted_GetRef();
+	Turn.Message.Role = Role;
+	Turn.Message.Content = Content;
+	Turn.Tokens = CountMessageTokens(Role, Content);
+
+	Window.Append(Turn.Message);
+	WindowTurnTokens += Turn.Tokens;
+	EnforceBudget();
+}
+
+void UGenChatContextManager::PinMessage(const FString& Role, const FString& Content)
+{
+	FTurn& Turn = Pinned.AddDefaulted_GetRef();
+	Turn.Message.Role = Role;
+	Turn.Message.Content = Content;
+	Turn.Tokens = CountMessageTokens(Role, Content);
+
+	RebuildPrefix();
+	RebuildWindow();
+	EnforceBudget();
+}
+
+void UGenChatContextManager::Clear()
+{
+	SummaryRequest.Cancel();
+	Pinned.Reset();
+	Summary.Reset();
+	Turns.Reset();
+	PendingSummaryTurns.Reset();
+	InFlightSummaryTurns.Reset();
+	NumSummaryFailures = 0;
+	RebuildPrefix();
+	RebuildWindow();
+}
+
+void UGenChatContextManager::ApplyToOpenAIChat(FGenChatSettings& ChatSettings)
+{
+	ChatOrg = EGenAIOrgs::OpenAI;
+	ChatSettings.History = Window;
+	ChatSettings.Messages.Reset();
+}
+
+void UGenChatContextManager::ApplyToClaudeChat(FGenClaudeChatSettings& ChatSettings)
+{
+	ChatOrg = EGenAIOrgs::Anthropic;
+	ChatSettings.Messages = Window.GetMessages();
+	ChatSettings.bCacheMessageHistory = true;
+}
+
+int32 UGenChatContextManager::CountMessageTokens(const FString& Role, const FString& Content) const
+{
+	return FGenTokenizer::TokensPerMessage + FGenTokenizer::CountTokensOrEstimate(Policy.Encoding, Role)
+		+ FGenTokenizer::CountTokensOrEstimate(Policy.Encoding, Content);
+}
+
+void UGenChatContextManager::EnforceBudget()
+{
+	GENAI_TRACE_SCOPE("GenAI::EnforceContextBudget");
+	const int32 Budget = Policy.GetPromptBudget();
+	int32 Tokens = GetContextTokens();
+	if (Tokens <= Budget || Turns.Num() == 0)
+	{
+		if (Tokens > Budget)
+		{
+			UE_LOG(LogGenAI, Warning, TEXT("Pinned messages and summary alone take %d of %d prompt tokens"), Tokens, Budget);
+		}
+		return;
+	}
+
+	// Down to the target in one go, so the next turns append to the window instead of rebuilding it
+	const int32 Target = FMath::FloorToInt32(Budget * Policy.TrimTargetRatio);
+	int32 NumTrimmed = 0;
+	while (NumTrimmed < Turns.Num() - Policy.MinRecentMessages && Tokens > Target)
+	{
+		Tokens -= Turns[NumTrimmed++].Tokens;
+	}
+
+	// The budget wins over MinRecentMessages, the newest turn is always kept
+	while (NumTrimmed < Turns.Num() - 1 && Tokens > Budget)
+	{
+		Tokens -= Turns[NumTrimmed++].Tokens;
+	}
+
+	// Start on a user turn, Anthropic rejects conversations opening with the assistant
+	while (NumTrimmed > 0 && NumTrimmed < Turns.Num() - 1 && Turns[NumTrimmed].Message.Role != TEXT("user"))
+	{
+		Tokens -= Turns[NumTrimmed++].Tokens;
+	}
+
+	if (Policy.bSummarizeTrimmedTurns)
+	{
+		for (int32 Index = 0; Index < NumTrimmed; ++Index)
+		{
+			PendingSummaryTurns.Add(MoveTemp(Turns[Index].Message));
+		}
+		CapPendingSummaryTurns();
+	}
+	Turns.RemoveAt(0, NumTrimmed);
+
+	if (Tokens > Budget)
+	{
+		// A single message larger than the whole budget, keep its beginning
+		FTurn& Newest = Turns.Last();
+		const int32 Available = FMath::Max(Budget - (Tokens - Newest.Tokens) - FGenTokenizer::TokensPerMessage, 0);
+		const FGenTokenizer* Tokenizer = FGenTokenizer::Get(Policy.Encoding);
+		Newest.Message.Content = Tokenizer ? Tokenizer->Truncate(Newest.Message.Content, Available) : Newest.Message.Content.Left(Available * 4);
+		Newest.Tokens = CountMessageTokens(Newest.Message.Role, Newest.Message.Content);
+		UE_LOG(LogGenAI, Warning, TEXT("Message exceeds the %d token prompt budget on its own, truncated to %d tokens"), Budget, Newest.Tokens);
+	}
+
+	UE_LOG(LogGenAIVerbose, Log, TEXT("Context trimmed %d turns, %d turns in the window"), NumTrimmed, Turns.Num());
+	RebuildWindow();
+	StartSummary();
+}
+
+void UGenChatContextManager::RebuildPrefix()
+{
+	Prefix.Reset();
+	PrefixTokens = 0;
+
+	TArray<FGenChatMessage> Messages;
+	Messages.Reserve(Pinned.Num() + 1);
+	for (const FTurn& Turn : Pinned)
+	{
+		Messages.Add(Turn.Message);
+		PrefixTokens += Turn.Tokens;
+	}
+	if (!Summary.IsEmpty())
+	{
+		FGenChatMessage& SummaryMessage = Messages.AddDefaulted_GetRef();
+		SummaryMessage.Role = TEXT("system");
+		SummaryMessage.Content = MakeSummaryMessage(Summary);
+		PrefixTokens += CountMessageTokens(SummaryMessage.Role, SummaryMessage.Content);
+	}
+	Prefix.Append(Messages);
+}
+
+void UGenChatContextManager::RebuildWindow()
+{
+	// Shares the prefix chunk, only the turns are serialized again
+	Window = Prefix;
+	WindowTurnTokens = 0;
+
+	TArray<FGenChatMessage> Messages;
+	Messages.Reserve(Turns.Num());
+	for (const FTurn& Turn : Turns)
+	{
+		Messages.Add(Turn.Message);
+		WindowTurnTokens += Turn.Tokens;
+	}
+	Window.Append(Messages);
+}
+
+void UGenChatContextManager::StartSummary()
+{
+	if (PendingSummaryTurns.Num() == 0 || SummaryRequest.IsPending())
+	{
+		return;
+	}
+
+	// Neither gets better by retrying, the turns are dropped instead of piling up
+	const EGenAIOrgs Org = Policy.SummaryOrg == EGenAIOrgs::Unknown ? ChatOrg : Policy.SummaryOrg;
+	const FString OrgName = UGenUtils::GetEnumDisplayName(StaticEnum<EGenAIOrgs>(), static_cast<int32>(Org));
+	if (Org != EGenAIOrgs::OpenAI && Org != EGenAIOrgs::Anthropic)
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("%s cannot summarize, OpenAI and Anthropic are supported, %d trimmed turns dropped"), *OrgName, PendingSummaryTurns.Num());
+		PendingSummaryTurns.Reset();
+		return;
+	}
+	if (UGenSecureKey::GetGenerativeAIApiKey(Org).IsEmpty())
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("No %s API key to summarize with, %d trimmed turns dropped"), *OrgName, PendingSummaryTurns.Num());
+		PendingSummaryTurns.Reset();
+		return;
+	}
+
+	FString Transcript;
+	if (!Summary.IsEmpty())
+	{
+		Transcript = FString::Printf(TEXT("Earlier summary:\n%s\n\n"), *Summary);
+	}
+	Transcript += TEXT("Transcript:\n");
+	for (const FGenChatMessage& Message : PendingSummaryTurns)
+	{
+		Transcript += FString::Printf(TEXT("%s: %s\n"), *Message.Role, *Message.Content);
+	}
+	InFlightSummaryTurns = MoveTemp(PendingSummaryTurns);
+	PendingSummaryTurns.Reset();
+
+	TArray<FGenChatMessage> Messages;
+	FGenChatMessage& Instructions = Messages.AddDefaulted_GetRef();
+	Instructions.Role = TEXT("system");
+	Instructions.Content = SummaryInstructions;
+	FGenChatMessage& TranscriptMessage = Messages.AddDefaulted_GetRef();
+	TranscriptMessage.Role = TEXT("user");
+	TranscriptMessage.Content = MoveTemp(Transcript);
+
+	FGenRequestOptions Options;
+	Options.Priority = EGenRequestPriority::Background;
+
+	TWeakObjectPtr<UGenChatContextManager> WeakThis(this);
+	FGenResponseCallback OnResponse = [WeakThis](const FString& Response, const FString& Error, bool bSuccess)
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->OnSummaryResponse(Response, Error, bSuccess);
+		}
+	};
+
+	if (Org == EGenAIOrgs::OpenAI)
+	{
+		FGenChatSettings SummarySettings;
+		SummarySettings.ModelEnum = Policy.SummaryModel.IsEmpty() ? EGenOAIChatModel::GPT_4_1_Nano : EGenOAIChatModel::Custom;
+		SummarySettings.CustomModel = Policy.SummaryModel;
+		SummarySettings.UpdateModel();
+		SummarySettings.MaxTokens = Policy.SummaryMaxTokens;
+		SummarySettings.Messages = MoveTemp(Messages);
+		SummarySettings.RequestOptions = Options;
+		SummaryRequest = TGenRequestEngine<FGenOpenAIChatTraits>::Send(SummarySettings, MoveTemp(OnResponse));
+	}
+	else
+	{
+		// The instructions are hoisted into the system prompt by the traits
+		FGenClaudeChatSettings SummarySettings;
+		SummarySettings.Model = Policy.SummaryModel.IsEmpty() ? EClaudeModels::Claude_3_5_Haiku : EClaudeModels::Custom;
+		SummarySettings.CustomModel = Policy.SummaryModel;
+		SummarySettings.MaxTokens = Policy.SummaryMaxTokens;
+		SummarySettings.Messages = MoveTemp(Messages);
+		SummarySettings.RequestOptions = Options;
+		SummaryRequest = TGenRequestEngine<FGenClaudeChatTraits>::Send(SummarySettings, MoveTemp(OnResponse));
+	}
+}
+
+void UGenChatContextManager::OnSummaryResponse(const FString& Response, const FString& Error, bool bSuccess)
+{
+	const FString NewSummary = Response.TrimStartAndEnd();
+	if (!bSuccess || NewSummary.IsEmpty())
+	{
+		if (++NumSummaryFailures >= MaxSummaryAttempts)
+		{
+			UE_LOG(LogGenAI, Warning, TEXT("Conversation summary failed %d times, %d trimmed turns dropped: %s"), NumSummaryFailures, InFlightSummaryTurns.Num(), *Error);
+			InFlightSummaryTurns.Reset();
+			NumSummaryFailures = 0;
+			return;
+		}
+
+		// Folded in with the next trimmed turns instead
+		UE_LOG(LogGenAI, Warning, TEXT("Conversation summary failed: %s"), *Error);
+		InFlightSummaryTurns.Append(MoveTemp(PendingSummaryTurns));
+		PendingSummaryTurns = MoveTemp(InFlightSummaryTurns);
+		InFlightSummaryTurns.Reset();
+		CapPendingSummaryTurns();
+		return;
+	}
+
+	InFlightSummaryTurns.Reset();
+	NumSummaryFailures = 0;
+	Summary = NewSummary;
+	RebuildPrefix();
+	RebuildWindow();
+	OnSummaryUpdated.Broadcast(Summary);
+
+	EnforceBudget();
+	StartSummary();
+}
+
+void UGenChatContextManager::CapPendingSummaryTurns()
+{
+	const int32 NumDropped = PendingSummaryTurns.Num() - MaxPendingSummaryTurns;
+	if (NumDropped > 0)
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("%d trimmed turns dropped without a summary, the summary falls behind the conversation"), NumDropped);
+		PendingSummaryTurns.RemoveAt(0, NumDropped);
+	}
+}
@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Data/GenChatConversation.h"
+
+UGenChatConversation* UGenChatConversation::CreateChatConversation()
+{
+	return NewObject<UGenChatConversation>();
+}
+
+UGenChatConversation* UGenChatConversation::Fork() const
+{
+	UGenChatConversation* Forked = NewObject<UGenChatConversation>();
+	Forked->Conversation = Conversation;
+	return Forked;
+}
+
+void UGenChatConversation::AddMessage(const FString& Role, const FString& Content)
+{
+	Conversation.Append(Role, Content);
+}
+
+void UGenChatConversation::AddMessages(const TArray<FGenChatMessage>& Messages)
+{
+	Conversation.Append(Messages);
+}
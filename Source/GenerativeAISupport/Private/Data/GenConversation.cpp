@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Data/GenConversation.h"
+
+#include "Data/OpenAI/GenOAIChatStructs.h"
+#include "Utilities/GenJsonPayloadWriter.h"
+
+struct FGenConversationChunk
+{
+	~FGenConversationChunk()
+	{
+		// Releases a long unshared chain one chunk at a time, a recursive release could run out of stack
+		TSharedPtr<const FGenConversationChunk, ESPMode::ThreadSafe> Next = MoveTemp(Parent);
+		while (Next.IsValid() && Next.IsUnique())
+		{
+			Next = MoveTemp(const_cast<FGenConversationChunk&>(*Next).Parent);
+		}
+	}
+
+	TSharedPtr<const FGenConversationChunk, ESPMode::ThreadSafe> Parent;
+	TArray<FGenChatMessage> Messages;
+
+	// {"role":..,"content":..},{..} for Messages
+	TArray<uint8> Json;
+
+	// Totals including every parent
+	int32 TotalMessages = 0;
+	int32 TotalJsonBytes = 0;
+	int32 Depth = 0;
+};
+
+void FGenConversation::Append(const FGenChatMessage& Message)
+{
+	Append(MakeArrayView(&Message, 1));
+}
+
+void FGenConversation::Append(TConstArrayView<FGenChatMessage> Messages)
+{
+	if (Messages.Num() == 0)
+	{
+		return;
+	}
+
+	const TSharedRef<FGenConversationChunk, ESPMode::ThreadSafe> Chunk = MakeShared<FGenConversationChunk, ESPMode::ThreadSafe>();
+	Chunk->Messages = Messages;
+
+	// Written as a standalone array body, the writer never needs a separator before the first element
+	FGenJsonPayloadWriter Writer(Chunk->Json);
+	for (int32 Index = 0; Index < Messages.Num(); ++Index)
+	{
+		if (Index > 0)
+		{
+			Chunk->Json.Add(',');
+		}
+		WriteMessage(Writer, Messages[Index].Role, Messages[Index].Content);
+	}
+
+	if (Tail.IsValid())
+	{
+		Chunk->TotalMessages = Tail->TotalMessages;
+		Chunk->TotalJsonBytes = Tail->TotalJsonBytes + 1;
+		Chunk->Depth = Tail->Depth + 1;
+	}
+	Chunk->TotalMessages += Messages.Num();
+	Chunk->TotalJsonBytes += Chunk->Json.Num();
+	Chunk->Parent = MoveTemp(Tail);
+	Tail = Chunk;
+}
+
+void FGenConversation::Append(const FString& Role, const FString& Content)
+{
+	FGenChatMessage Message;
+	Message.Role = Role;
+	Message.Content = Content;
+	Append(Message);
+}
+
+int32 FGenConversation::Num() const
+{
+	return Tail.IsValid() ? Tail->TotalMessages : 0;
+}
+
+int32 FGenConversation::GetSerializedSize() const
+{
+	return Tail.IsValid() ? Tail->TotalJsonBytes : 0;
+}
+
+TArray<FGenChatMessage> FGenConversation::GetMessages() const
+{
+	TArray<FGenChatMessage> Messages;
+	Messages.SetNum(Num());
+	int32 End = Messages.Num();
+	for (const FGenConversationChunk* Chunk = Tail.Get(); Chunk; Chunk = Chunk->Parent.Get())
+	{
+		End -= Chunk->Messages.Num();
+		for (int32 Index = 0; Index < Chunk->Messages.Num(); ++Index)
+		{
+			Messages[End + Index] = Chunk->Messages[Index];
+		}
+	}
+	return Messages;
+}
+
+void FGenConversation::WriteMessages(FGenJsonPayloadWriter& Writer) const
+{
+	if (!Tail.IsValid())
+	{
+		return;
+	}
+
+	// Chunks link to their parent, the payload wants the oldest first
+	TArray<const FGenConversationChunk*, TInlineAllocator<64>> Chunks;
+	Chunks.Reserve(Tail->Depth + 1);
+	for (const FGenConversationChunk* Chunk = Tail.Get(); Chunk; Chunk = Chunk->Parent.Get())
+	{
+		Chunks.Add(Chunk);
+	}
+	for (int32 Index = Chunks.Num() - 1; Index >= 0; --Index)
+	{
+		Writer.WriteRawJson(FStringView(), Chunks[Index]->Json);
+	}
+}
+
+void FGenConversation::WriteMessage(FGenJsonPayloadWriter& Writer, const FString& Role, const FString& Content)
+{
+	Writer.BeginObject();
+	Writer.WriteString(TEXT("role"), Role);
+	Writer.WriteString(TEXT("content"), Content);
+	Writer.EndObject();
+}
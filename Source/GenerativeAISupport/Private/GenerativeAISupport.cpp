@@ -2,6 +2,10 @@
 
 #include "GenerativeAISupport.h"
 
+#include "Misc/CoreDelegates.h"
+#include "Network/GenConnectionWarmer.h"
+#include "Utilities/GenSchemaRegistry.h"
+
 #define LOCTEXT_NAMESPACE "FGenerativeAISupportModule"
 
 FGenerativeAISupportModule::FGenerativeAISupportModule()
@@ -13,11 +17,28 @@ void FGenerativeAISupportModule::StartupModule()
 {
 	// Log to debug module loading
 	UE_LOG(LogTemp, Log, TEXT("FGenerativeAISupportModule::StartupModule called"));
+
+	// Open provider connections and compile the schemas of GENAI_REGISTER_SCHEMA structs as soon as the HTTP module, the settings
+	// and the game modules are up, unless the module was loaded later than that
+	if (GIsRunning)
+	{
+		FGenConnectionWarmer::Get().Start();
+		FGenSchemaRegistry::Get().CompilePendingStructs();
+	}
+	else
+	{
+		EngineLoopInitHandle = FCoreDelegates::OnFEngineLoopInitComplete.AddLambda([]()
+		{
+			FGenConnectionWarmer::Get().Start();
+			FGenSchemaRegistry::Get().CompilePendingStructs();
+		});
+	}
 }
 
 void FGenerativeAISupportModule::ShutdownModule()
 {
-	// Runtime module cleanup if needed
+	FCoreDelegates::OnFEngineLoopInitComplete.Remove(EngineLoopInitHandle);
+	FGenConnectionWarmer::Get().Stop();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,81 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+
+#include "GenerativeAISupportRuntimeSettings.h"
+
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+namespace
+{
+    // -GenAIBaseUrl=http://127.0.0.1:8080 points every provider at one local stand-in, for automation and load tests.
+    // Parsed on first use, the command line does not change afterwards and every request asks for the base URL
+    const FString& GetCommandLineBaseUrl()
+    {
+        static const FString BaseUrl = []()
+        {
+            FString Value;
+            FParse::Value(FCommandLine::Get(), TEXT("GenAIBaseUrl="), Value);
+            Value.RemoveFromEnd(TEXT("/"));
+            return Value;
+        }();
+        return BaseUrl;
+    }
+}
+
+UGenerativeAISupportRuntimeSettings::UGenerativeAISupportRuntimeSettings()
+    : ResponseCacheMaxEntries(256)
+    , bPersistResponseCache(true)
+    , DefaultMaxConcurrentRequests(8)
+    , RetryBaseDelaySeconds(1.0f)
+    , RetryMaxDelaySeconds(30.0f)
+    , RetryBudgetRatio(0.2f)
+    , ConnectionKeepAliveSeconds(0.0f)
+    , RequestCompressionMinBytes(8192)
+    , bAcceptCompressedResponses(true)
+    , BatchPollIntervalSeconds(30.0f)
+    , RouterCircuitFailureThreshold(5)
+    , RouterCircuitCooldownSeconds(30.0f)
+    , RouterDefaultHedgeDelaySeconds(8.0f)
+    , RouterMinHedgeDelaySeconds(1.0f)
+{
+    MaxConcurrentRequests.Add(EGenAIOrgs::OpenAI, 16);
+    MaxConcurrentRequests.Add(EGenAIOrgs::Anthropic, 8);
+}
+
+int32 UGenerativeAISupportRuntimeSettings::GetMaxConcurrentRequests(EGenAIOrgs Org) const
+{
+    const int32* Limit = MaxConcurrentRequests.Find(Org);
+    return FMath::Max(1, Limit ? *Limit : DefaultMaxConcurrentRequests);
+}
+
+FString UGenerativeAISupportRuntimeSettings::GetBaseUrl(EGenAIOrgs Org) const
+{
+    if (const FString& CommandLineBaseUrl = GetCommandLineBaseUrl(); !CommandLineBaseUrl.IsEmpty())
+    {
+        return CommandLineBaseUrl;
+    }
+
+    if (const FString* Override = BaseUrlOverrides.Find(Org); Override && !Override->IsEmpty())
+    {
+        FString BaseUrl = *Override;
+        BaseUrl.RemoveFromEnd(TEXT("/"));
+        return BaseUrl;
+    }
+
+    switch (Org)
+    {
+    case EGenAIOrgs::OpenAI:
+        return TEXT("https://api.openai.com");
+    case EGenAIOrgs::Anthropic:
+        return TEXT("https://api.anthropic.com");
+    case EGenAIOrgs::DeepSeek:
+        return TEXT("https://api.deepseek.com");
+    case EGenAIOrgs::XAI:
+        return TEXT("https://api.x.ai");
+    default:
+        return FString();
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Models/GenRoutedChat.h"
+
+FGenRoutedRequestHandle UGenRoutedChat::SendChatRequest(const FGenRoutedChatSettings& ChatSettings, const FOnRoutedChatCompletionResponse& OnComplete)
+{
+	return FGenProviderRouter::Get().Send(ChatSettings, [OnComplete](const FString& Response, const FString& Error, bool Success)
+	{
+		OnComplete.ExecuteIfBound(Response, Error, Success);
+	});
+}
+
+FGenRoutedRequestHandle UGenRoutedChat::SendChatRequest(const FGenRoutedChatSettings& ChatSettings, const FOnRoutedChatStreamDelta& OnDelta,
+                                                        const FOnRoutedChatCompletionResponse& OnComplete)
+{
+	return FGenProviderRouter::Get().Send(ChatSettings, [OnComplete](const FString& Response, const FString& Error, bool Success)
+	{
+		OnComplete.ExecuteIfBound(Response, Error, Success);
+	},
+	[OnDelta](const FGenChatStreamDelta& Delta)
+	{
+		if (!Delta.Content.IsEmpty())
+		{
+			OnDelta.ExecuteIfBound(Delta.Content);
+		}
+	});
+}
+
+UGenRoutedChat* UGenRoutedChat::RequestRoutedChat(UObject* WorldContextObject, const FGenRoutedChatSettings& ChatSettings)
+{
+	UGenRoutedChat* AsyncAction = NewObject<UGenRoutedChat>();
+	AsyncAction->ChatSettings = ChatSettings;
+	AsyncAction->RegisterWithGameInstance(WorldContextObject);
+	return AsyncAction;
+}
+
+void UGenRoutedChat::Activate()
+{
+	TWeakObjectPtr<UGenRoutedChat> WeakThis(this);
+	RequestHandle = FGenProviderRouter::Get().Send(ChatSettings, [WeakThis](const FString& Response, const FString& Error, bool Success)
+	{
+		if (UGenRoutedChat* StrongThis = WeakThis.Get())
+		{
+			StrongThis->OnComplete.Broadcast(Response, Error, Success);
+			StrongThis->Cancel();
+		}
+	},
+	[WeakThis](const FGenChatStreamDelta& Delta)
+	{
+		if (WeakThis.IsValid() && !Delta.Content.IsEmpty())
+		{
+			WeakThis->OnStreamDelta.Broadcast(Delta.Content);
+		}
+	});
+}
+
+void UGenRoutedChat::Cancel()
+{
+	// Cancels every attempt still in flight, hedges included
+	RequestHandle.Cancel();
+	Super::Cancel();
+}
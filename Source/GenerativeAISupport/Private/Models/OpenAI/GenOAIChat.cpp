@@ -2,171 +2,93 @@
 
 
 #include "Models/OpenAI/GenOAIChat.h"
-#include "Secure/GenSecureKey.h"
-#include "Http.h"
-#include "LatentActions.h"
-#include "Data/GenAIOrgs.h"
-#include "Data/OpenAI/GenOAIChatStructs.h"
-#include "Dom/JsonObject.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
-#include "Engine/Engine.h"  // For GEngine and screen logging
-#include "Utilities/GenGlobalDefinitions.h"
+#include "Network/GenProviderTraits.h"
 
 
-TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> UGenOAIChat::SendChatRequest(const FGenChatSettings& ChatSettings, const FOnChatCompletionResponse& OnComplete)
+FGenRequestHandle UGenOAIChat::SendChatRequest(const FGenChatSettings& ChatSettings, const FOnChatCompletionResponse& OnComplete)
 {
 	check(OnComplete.IsBound());
-	return MakeRequest(ChatSettings, [OnComplete](const FString& Response, const FString& Error, bool Success)
+	return TGenRequestEngine<FGenOpenAIChatTraits>::Send(ChatSettings, [OnComplete](const FString& Response, const FString& Error, bool Success)
 	{
 		OnComplete.Execute(Response, Error, Success);
 	});
 }
 
-UGenOAIChat* UGenOAIChat::RequestOpenAIChat(UObject* WorldContextObject, const FGenChatSettings& ChatSettings)
-{
-	UGenOAIChat* AsyncAction = NewObject<UGenOAIChat>();
-	AsyncAction->ChatSettings = ChatSettings;
-	AsyncAction->RegisterWithGameInstance(WorldContextObject);
-	return AsyncAction;
-}
-
-void UGenOAIChat::Activate()
+FGenRequestHandle UGenOAIChat::SendChatRequest(const FGenChatSettings& ChatSettings, const FOnChatStreamDelta& OnDelta,
+                                               const FOnChatCompletionResponse& OnComplete)
 {
-	TWeakObjectPtr<UGenOAIChat> WeakThis(this);
-	HttpRequest = MakeRequest(ChatSettings, [WeakThis](const FString& Response, const FString& Error, bool Success)
+	check(OnComplete.IsBound());
+	return TGenRequestEngine<FGenOpenAIChatTraits>::Send(ChatSettings, [OnComplete](const FString& Response, const FString& Error, bool Success)
 	{
-		if (WeakThis.IsValid())
+		OnComplete.Execute(Response, Error, Success);
+	},
+	[OnDelta](const FGenChatStreamDelta& Delta)
+	{
+		if (!Delta.Content.IsEmpty())
 		{
-			UGenOAIChat* StrongThis = WeakThis.Get();
-			StrongThis->OnComplete.Broadcast(Response, Error, Success);
-			StrongThis->Cancel();
+			OnDelta.ExecuteIfBound(Delta.Content);
 		}
 	});
 }
 
-void UGenOAIChat::Cancel()
+UGenOAIChat* UGenOAIChat::RequestOpenAIChat(UObject* WorldContextObject, const FGenChatSettings& ChatSettings)
 {
-	if (HttpRequest.IsValid() && HttpRequest->GetStatus() == EHttpRequestStatus::Processing)
-	{
-		HttpRequest->CancelRequest();
-	}
-	Super::Cancel();
+	UGenOAIChat* AsyncAction = NewObject<UGenOAIChat>();
+	AsyncAction->ChatSettings = ChatSettings;
+	AsyncAction->RegisterWithGameInstance(WorldContextObject);
+	return AsyncAction;
 }
 
-TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> UGenOAIChat::MakeRequest(const FGenChatSettings& ChatSettings,
-                              const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback)
+UGenOAIChat* UGenOAIChat::RequestOpenAIConversationChat(UObject* WorldContextObject, UGenChatConversation* Conversation,
+                                                        const FString& UserMessage, const FGenChatSettings& ChatSettings)
 {
-	const FString ApiKey = UGenSecureKey::GetGenerativeAIApiKey(EGenAIOrgs::OpenAI);
-	if (ApiKey.IsEmpty())
-	{
-		ResponseCallback(TEXT(""), TEXT("API key not set"), false);
-		return nullptr;
-	}
-
-	// Make a mutable copy so we can update the model
-	FGenChatSettings MutableSettings = ChatSettings;
-	MutableSettings.UpdateModel();
-
-	const TSharedPtr<FJsonObject> JsonPayload = MakeShareable(new FJsonObject());
-	JsonPayload->SetStringField(TEXT("model"), MutableSettings.Model);
-	JsonPayload->SetNumberField(TEXT("max_completion_tokens"), MutableSettings.MaxTokens);
-	JsonPayload->SetNumberField(TEXT("temperature"), MutableSettings.Temperature);
-	JsonPayload->SetNumberField(TEXT("top_p"), MutableSettings.TopP);
-	if (!MutableSettings.Stop.IsEmpty())
-	{
-		JsonPayload->SetStringField(TEXT("stop"), MutableSettings.Stop);
-	}
-	
-	if (MutableSettings.ReasoningEffort != EGenAIOpenAIReasoningEffort::Default)
-	{
-		const FString ReasoningEffortString = StaticEnum<EGenAIOpenAIReasoningEffort>()->GetNameStringByValue(static_cast<int64>(MutableSettings.ReasoningEffort));
-		JsonPayload->SetStringField(TEXT("reasoning_effort"), ReasoningEffortString.ToLower());
-	}
-
-	if (MutableSettings.Verbosity != EGenAIOpenAIVerbosity::Default)
-	{
-		const FString VerbosityString = StaticEnum<EGenAIOpenAIVerbosity>()->GetNameStringByValue(static_cast<int64>(MutableSettings.Verbosity));
-		JsonPayload->SetStringField(TEXT("verbosity"), VerbosityString.ToLower());
-	}
+	UGenOAIChat* AsyncAction = RequestOpenAIChat(WorldContextObject, ChatSettings);
+	AsyncAction->Conversation = Conversation;
+	AsyncAction->UserMessage = UserMessage;
+	return AsyncAction;
+}
 
-	TArray<TSharedPtr<FJsonValue>> MessagesArray;
-	for (const auto& [Role, Content] : MutableSettings.Messages)
+void UGenOAIChat::Activate()
+{
+	if (Conversation)
 	{
-		const TSharedPtr<FJsonObject> JsonMessage = MakeShareable(new FJsonObject());
-		JsonMessage->SetStringField(TEXT("role"), Role);
-		JsonMessage->SetStringField(TEXT("content"), Content);
-		MessagesArray.Add(MakeShareable(new FJsonValueObject(JsonMessage)));
-	}
-	JsonPayload->SetArrayField(TEXT("messages"), MessagesArray);
-
-	FString PayloadString;
-	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&PayloadString);
-	FJsonSerializer::Serialize(JsonPayload.ToSharedRef(), Writer);
-
-	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-	HttpRequest->SetVerb(TEXT("POST"));
-	HttpRequest->SetURL(TEXT("https://api.openai.com/v1/chat/completions"));
-	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-	HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *ApiKey));
-	HttpRequest->SetContentAsString(PayloadString);
-
-	//UE_LOG(LogGenAIVerbose, Log, TEXT("Sending chat request... Payload: %s"), *PayloadString);
-
-	HttpRequest->OnProcessRequestComplete().BindLambda(
-		[ResponseCallback](FHttpRequestPtr Request, const FHttpResponsePtr& Response, const bool bSuccess)
+		ChatSettings.History = Conversation->GetConversation();
+		if (!UserMessage.IsEmpty())
 		{
-			if (!bSuccess || !Response.IsValid())
-			{
-				ResponseCallback(TEXT(""), TEXT("Request failed"), false);
-				UE_LOG(LogGenAI, Error, TEXT("Request failed, Response code: %d"),
-				       Response.IsValid() ? Response->GetResponseCode() : -1);
-				return;
-			}
-			ProcessResponse(Response->GetContentAsString(), ResponseCallback);
-		});
-
-	HttpRequest->ProcessRequest();
-	return HttpRequest;
-}
+			ChatSettings.History.Append(TEXT("user"), UserMessage);
+		}
+	}
 
-void UGenOAIChat::ProcessResponse(const FString& ResponseStr,
-                                  const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback)
-{
-	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseStr);
-	TSharedPtr<FJsonObject> JsonObject;
-	if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+	TWeakObjectPtr<UGenOAIChat> WeakThis(this);
+	RequestHandle = TGenRequestEngine<FGenOpenAIChatTraits>::Send(ChatSettings, [WeakThis](const FString& Response, const FString& Error, bool Success)
 	{
-		const TArray<TSharedPtr<FJsonValue>>* ChoicesArray;
-		if (JsonObject->TryGetArrayField(TEXT("choices"), ChoicesArray) && ChoicesArray->Num() > 0)
+		if (WeakThis.IsValid())
 		{
-			const TSharedPtr<FJsonObject>* FirstChoiceObject;
-			if ((*ChoicesArray)[0]->TryGetObject(FirstChoiceObject))
+			UGenOAIChat* StrongThis = WeakThis.Get();
+			if (Success && StrongThis->Conversation)
 			{
-				const TSharedPtr<FJsonObject>* MessageObject;
-				if ((*FirstChoiceObject)->TryGetObjectField(TEXT("message"), MessageObject))
+				if (!StrongThis->UserMessage.IsEmpty())
 				{
-					FString Content;
-					if ((*MessageObject)->TryGetStringField(TEXT("content"), Content))
-					{
-						ResponseCallback(Content, TEXT(""), true);
-						return;
-					}
+					StrongThis->Conversation->AddMessage(TEXT("user"), StrongThis->UserMessage);
 				}
+				StrongThis->Conversation->AddMessage(TEXT("assistant"), Response);
 			}
+			StrongThis->OnComplete.Broadcast(Response, Error, Success);
+			StrongThis->Cancel();
 		}
-
-		FString ErrorMessage;
-		const TSharedPtr<FJsonObject>* ErrorObject;
-		if (JsonObject->TryGetObjectField(TEXT("error"), ErrorObject))
+	},
+	[WeakThis](const FGenChatStreamDelta& Delta)
+	{
+		if (WeakThis.IsValid() && !Delta.Content.IsEmpty())
 		{
-			if ((*ErrorObject)->TryGetStringField(TEXT("message"), ErrorMessage))
-			{
-				ResponseCallback(TEXT(""), ErrorMessage, false);
-				return;
-			}
+			WeakThis->OnStreamDelta.Broadcast(Delta.Content);
 		}
-	}
+	});
+}
 
-	ResponseCallback(TEXT(""), FString::Printf(TEXT("Failed to parse response: %s"), *ResponseStr), false);
+void UGenOAIChat::Cancel()
+{
+	// Only detaches this action, other callers coalesced onto the same request keep waiting for it
+	RequestHandle.Cancel();
+	Super::Cancel();
 }
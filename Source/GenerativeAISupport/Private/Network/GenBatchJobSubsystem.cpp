@@ -0,0 +1,739 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenBatchJobSubsystem.h"
+
+#include "Dom/JsonObject.h"
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Network/GenProviderTraits.h"
+#include "Secure/GenSecureKey.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenJsonPayloadWriter.h"
+#include "Utilities/GenJsonPullReader.h"
+
+namespace
+{
+	constexpr const ANSICHAR* MultipartBoundary = "GenAIBatchBoundary9c4e1f7a";
+
+	FString GetJobsFilePath()
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("GenAI"), TEXT("BatchJobs.json"));
+	}
+
+	// Results come back in any order, the custom_id routes them to the item they belong to
+	FString MakeCustomId(int32 ItemIndex)
+	{
+		return FString::Printf(TEXT("item-%d"), ItemIndex);
+	}
+
+	int32 ParseCustomId(const FString& CustomId)
+	{
+		return CustomId.StartsWith(TEXT("item-")) ? FCString::Atoi(*CustomId + 5) : INDEX_NONE;
+	}
+
+	void AppendAscii(TArray<uint8>& Buffer, const ANSICHAR* Text)
+	{
+		Buffer.Append(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+	}
+
+	bool IsOkResponse(const FHttpResponsePtr& Response, bool bSucceeded)
+	{
+		return bSucceeded && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode());
+	}
+
+	// Reasons a job fails before anything is sent
+	FString GetSubmitError(EGenAIOrgs Org, int32 NumItems)
+	{
+		if (NumItems == 0)
+		{
+			return TEXT("Batch has no items");
+		}
+		if (UGenSecureKey::GetGenerativeAIApiKey(Org).IsEmpty())
+		{
+			return FString::Printf(TEXT("%s API key not set"), *UEnum::GetDisplayValueAsText(Org).ToString());
+		}
+		return FString();
+	}
+
+	FString DescribeFailure(const FHttpResponsePtr& Response)
+	{
+		if (!Response.IsValid())
+		{
+			return TEXT("No response received");
+		}
+
+		FGenJsonFieldQuery ErrorMessage("error.message");
+		FGenJsonFieldQuery* const Queries[] = {&ErrorMessage};
+		GenJson::ExtractFields(Response->GetContent(), Queries);
+		return FString::Printf(TEXT("HTTP %d: %s"), Response->GetResponseCode(),
+		                       ErrorMessage.IsString() ? *ErrorMessage.Value : *GenJson::ToDebugString(Response->GetContent()));
+	}
+}
+
+void UGenBatchJobSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LoadJobs();
+	for (FGenBatchJobInfo& Job : Jobs)
+	{
+		// Nothing to resume from, the batch may or may not exist on the provider's side
+		if (Job.Status == EGenBatchJobStatus::Submitting)
+		{
+			Job.Status = EGenBatchJobStatus::Failed;
+			Job.Error = TEXT("Interrupted before the batch was created");
+		}
+	}
+
+	const float PollInterval = GetDefault<UGenerativeAISupportRuntimeSettings>()->BatchPollIntervalSeconds;
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UGenBatchJobSubsystem::Tick), PollInterval);
+}
+
+void UGenBatchJobSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	SaveJobs();
+	Callbacks.Empty();
+
+	Super::Deinitialize();
+}
+
+FString UGenBatchJobSubsystem::SubmitOpenAIChatBatch(const TArray<FGenChatSettings>& Items, const FOnGenBatchItemResult& OnItemResult,
+                                                     const FOnGenBatchJobFinished& OnFinished)
+{
+	const FString JobId = AddJob(EGenAIOrgs::OpenAI, Items.Num(), OnItemResult, OnFinished);
+	if (const FString Error = GetSubmitError(EGenAIOrgs::OpenAI, Items.Num()); !Error.IsEmpty())
+	{
+		FinishNextTick(JobId, EGenBatchJobStatus::Failed, Error);
+		return JobId;
+	}
+
+	// One request per line: {"custom_id":"item-0","method":"POST","url":"/v1/chat/completions","body":{...}}
+	TArray<uint8> Lines;
+	TArray<uint8> Body;
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+	{
+		FGenChatSettings Settings = Items[ItemIndex];
+		Settings.bStreamResponse = false;
+
+		Body.Reset();
+		FString Error;
+		if (!FGenOpenAIChatTraits::BuildPayload(Settings, Body, Error))
+		{
+			FinishNextTick(JobId, EGenBatchJobStatus::Failed, FString::Printf(TEXT("Item %d: %s"), ItemIndex, *Error));
+			return JobId;
+		}
+
+		FGenJsonPayloadWriter Writer(Lines);
+		Writer.BeginObject();
+		Writer.WriteString(TEXT("custom_id"), MakeCustomId(ItemIndex));
+		Writer.WriteString(TEXT("method"), TEXT("POST"));
+		Writer.WriteString(TEXT("url"), TEXT("/v1/chat/completions"));
+		Writer.WriteRawJson(TEXT("body"), Body);
+		Writer.EndObject();
+		Lines.Add('\n');
+	}
+
+	UploadOpenAIBatchFile(JobId, MoveTemp(Lines));
+	return JobId;
+}
+
+FString UGenBatchJobSubsystem::SubmitClaudeChatBatch(const TArray<FGenClaudeChatSettings>& Items, const FOnGenBatchItemResult& OnItemResult,
+                                                     const FOnGenBatchJobFinished& OnFinished)
+{
+	const FString JobId = AddJob(EGenAIOrgs::Anthropic, Items.Num(), OnItemResult, OnFinished);
+	if (const FString Error = GetSubmitError(EGenAIOrgs::Anthropic, Items.Num()); !Error.IsEmpty())
+	{
+		FinishNextTick(JobId, EGenBatchJobStatus::Failed, Error);
+		return JobId;
+	}
+
+	// {"requests":[{"custom_id":"item-0","params":{...}}, ...]}
+	TArray<uint8> Payload;
+	TArray<uint8> Params;
+	FGenJsonPayloadWriter Writer(Payload);
+	Writer.BeginObject();
+	Writer.BeginArray(TEXT("requests"));
+	for (int32 ItemIndex = 0; ItemIndex < Items.Num(); ++ItemIndex)
+	{
+		FGenClaudeChatSettings Settings = Items[ItemIndex];
+		Settings.bStreamResponse = false;
+
+		Params.Reset();
+		FString Error;
+		if (!FGenClaudeChatTraits::BuildPayload(Settings, Params, Error))
+		{
+			FinishNextTick(JobId, EGenBatchJobStatus::Failed, FString::Printf(TEXT("Item %d: %s"), ItemIndex, *Error));
+			return JobId;
+		}
+
+		Writer.BeginObject();
+		Writer.WriteString(TEXT("custom_id"), MakeCustomId(ItemIndex));
+		Writer.WriteRawJson(TEXT("params"), Params);
+		Writer.EndObject();
+	}
+	Writer.EndArray();
+	Writer.EndObject();
+
+	CreateClaudeBatch(JobId, MoveTemp(Payload));
+	return JobId;
+}
+
+FString UGenBatchJobSubsystem::RequestOpenAIChatBatch(const TArray<FGenChatSettings>& Items)
+{
+	return SubmitOpenAIChatBatch(Items, FOnGenBatchItemResult());
+}
+
+FString UGenBatchJobSubsystem::RequestClaudeChatBatch(const TArray<FGenClaudeChatSettings>& Items)
+{
+	return SubmitClaudeChatBatch(Items, FOnGenBatchItemResult());
+}
+
+void UGenBatchJobSubsystem::CancelJob(const FString& JobId)
+{
+	FGenBatchJobInfo* Job = FindJob(JobId);
+	if (!Job || Job->IsFinished() || Job->bCancelRequested)
+	{
+		return;
+	}
+
+	Job->bCancelRequested = true;
+	SaveJobs();
+	// Without a provider id yet the cancel goes out as soon as the batch has been created
+	if (!Job->ProviderBatchId.IsEmpty() && Job->Status == EGenBatchJobStatus::InProgress)
+	{
+		SendCancel(*Job);
+	}
+}
+
+bool UGenBatchJobSubsystem::GetJob(const FString& JobId, FGenBatchJobInfo& OutJob) const
+{
+	const FGenBatchJobInfo* Job = Jobs.FindByPredicate([&JobId](const FGenBatchJobInfo& Candidate) { return Candidate.JobId == JobId; });
+	if (!Job)
+	{
+		return false;
+	}
+	OutJob = *Job;
+	return true;
+}
+
+void UGenBatchJobSubsystem::RemoveFinishedJobs()
+{
+	if (Jobs.RemoveAll([](const FGenBatchJobInfo& Job) { return Job.IsFinished(); }) > 0)
+	{
+		SaveJobs();
+	}
+}
+
+FString UGenBatchJobSubsystem::AddJob(EGenAIOrgs Org, int32 NumItems, const FOnGenBatchItemResult& OnItemResult, const FOnGenBatchJobFinished& OnFinished)
+{
+	FGenBatchJobInfo& Job = Jobs.AddDefaulted_GetRef();
+	Job.JobId = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+	Job.Org = Org;
+	Job.NumItems = NumItems;
+	Job.SubmittedAt = FDateTime::UtcNow();
+
+	FJobCallbacks& JobCallbacks = Callbacks.Add(Job.JobId);
+	JobCallbacks.OnItemResult = OnItemResult;
+	JobCallbacks.OnFinished = OnFinished;
+	return Job.JobId;
+}
+
+FGenBatchJobInfo* UGenBatchJobSubsystem::FindJob(const FString& JobId)
+{
+	return Jobs.FindByPredicate([&JobId](const FGenBatchJobInfo& Job) { return Job.JobId == JobId; });
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UGenBatchJobSubsystem::CreateRequest(EGenAIOrgs Org, const FString& Verb, const FString& UrlOrPath)
+{
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+	Request->SetVerb(Verb);
+	Request->SetURL(UrlOrPath.StartsWith(TEXT("http")) ? UrlOrPath : GetDefault<UGenerativeAISupportRuntimeSettings>()->GetBaseUrl(Org) + UrlOrPath);
+
+	const FString ApiKey = UGenSecureKey::GetGenerativeAIApiKey(Org);
+	if (Org == EGenAIOrgs::Anthropic)
+	{
+		FGenClaudeChatTraits::SetAuthHeaders(*Request, ApiKey);
+	}
+	else
+	{
+		FGenChatCompletionsTraits::SetAuthHeaders(*Request, ApiKey);
+	}
+	return Request;
+}
+
+void UGenBatchJobSubsystem::UploadOpenAIBatchFile(const FString& JobId, TArray<uint8>&& Lines)
+{
+	const FGenBatchJobInfo* Job = FindJob(JobId);
+	if (!Job || Job->IsFinished())
+	{
+		return;
+	}
+
+	// The input file goes up as multipart/form-data, https://platform.openai.com/docs/api-reference/files/create
+	TArray<uint8> Content;
+	Content.Reserve(Lines.Num() + 512);
+	AppendAscii(Content, "--");
+	AppendAscii(Content, MultipartBoundary);
+	AppendAscii(Content, "\r\nContent-Disposition: form-data; name=\"purpose\"\r\n\r\nbatch\r\n--");
+	AppendAscii(Content, MultipartBoundary);
+	AppendAscii(Content, "\r\nContent-Disposition: form-data; name=\"file\"; filename=\"batch.jsonl\"\r\nContent-Type: application/jsonl\r\n\r\n");
+	Content.Append(Lines);
+	AppendAscii(Content, "\r\n--");
+	AppendAscii(Content, MultipartBoundary);
+	AppendAscii(Content, "--\r\n");
+
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(EGenAIOrgs::OpenAI, TEXT("POST"), TEXT("/v1/files"));
+	Request->SetHeader(TEXT("Content-Type"), TEXT("multipart/form-data; boundary=") + FString(MultipartBoundary));
+	Request->SetContent(MoveTemp(Content));
+	Request->OnProcessRequestComplete().BindWeakLambda(this, [this, JobId](FHttpRequestPtr, FHttpResponsePtr Response, bool bSucceeded)
+	{
+		if (!IsOkResponse(Response, bSucceeded))
+		{
+			Finish(JobId, EGenBatchJobStatus::Failed, FString::Printf(TEXT("Batch file upload failed, %s"), *DescribeFailure(Response)));
+			return;
+		}
+
+		FGenJsonFieldQuery FileId("id");
+		FGenJsonFieldQuery* const Queries[] = {&FileId};
+		GenJson::ExtractFields(Response->GetContent(), Queries);
+		if (!FileId.IsString())
+		{
+			Finish(JobId, EGenBatchJobStatus::Failed, TEXT("Batch file upload returned no file id"));
+			return;
+		}
+		CreateOpenAIBatch(JobId, FileId.Value);
+	});
+	Request->ProcessRequest();
+	SaveJobs();
+}
+
+void UGenBatchJobSubsystem::CreateOpenAIBatch(const FString& JobId, const FString& InputFileId)
+{
+	TArray<uint8> Payload;
+	FGenJsonPayloadWriter Writer(Payload);
+	Writer.BeginObject();
+	Writer.WriteString(TEXT("input_file_id"), InputFileId);
+	Writer.WriteString(TEXT("endpoint"), TEXT("/v1/chat/completions"));
+	Writer.WriteString(TEXT("completion_window"), TEXT("24h"));
+	Writer.EndObject();
+
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(EGenAIOrgs::OpenAI, TEXT("POST"), TEXT("/v1/batches"));
+	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	Request->SetContent(MoveTemp(Payload));
+	SendBatchRequest(JobId, Request, true);
+}
+
+void UGenBatchJobSubsystem::CreateClaudeBatch(const FString& JobId, TArray<uint8>&& Payload)
+{
+	if (const FGenBatchJobInfo* Job = FindJob(JobId); !Job || Job->IsFinished())
+	{
+		return;
+	}
+
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(EGenAIOrgs::Anthropic, TEXT("POST"), TEXT("/v1/messages/batches"));
+	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	Request->SetContent(MoveTemp(Payload));
+	SendBatchRequest(JobId, Request, true);
+	SaveJobs();
+}
+
+void UGenBatchJobSubsystem::SendBatchRequest(const FString& JobId, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, bool bFailOnError)
+{
+	BusyJobs.Add(JobId);
+	Request->OnProcessRequestComplete().BindWeakLambda(this, [this, JobId, bFailOnError](FHttpRequestPtr, FHttpResponsePtr Response, bool bSucceeded)
+	{
+		BusyJobs.Remove(JobId);
+		if (IsOkResponse(Response, bSucceeded))
+		{
+			ApplyStatus(JobId, Response->GetContent());
+		}
+		else if (bFailOnError || (Response.IsValid() && Response->GetResponseCode() == EHttpResponseCodes::NotFound))
+		{
+			Finish(JobId, EGenBatchJobStatus::Failed, DescribeFailure(Response));
+		}
+		else
+		{
+			// Status polls are repeated anyway, a hiccup is not worth failing a job that may run for hours
+			UE_LOG(LogGenAI, Warning, TEXT("Batch job %s: status request failed, %s"), *JobId, *DescribeFailure(Response));
+		}
+	});
+	Request->ProcessRequest();
+}
+
+bool UGenBatchJobSubsystem::Tick(float DeltaTime)
+{
+	// Collecting may finish a job right away, and completion delegates are free to remove jobs
+	TArray<FString> ToCollect;
+	for (const FGenBatchJobInfo& Job : Jobs)
+	{
+		if (BusyJobs.Contains(Job.JobId))
+		{
+			continue;
+		}
+
+		if (Job.Status == EGenBatchJobStatus::InProgress)
+		{
+			Poll(Job);
+		}
+		else if (Job.Status == EGenBatchJobStatus::Collecting)
+		{
+			// Jobs whose collection was interrupted by a failed download or a restart
+			ToCollect.Add(Job.JobId);
+		}
+	}
+
+	for (const FString& JobId : ToCollect)
+	{
+		Collect(JobId, false);
+	}
+	return true;
+}
+
+void UGenBatchJobSubsystem::Poll(const FGenBatchJobInfo& Job)
+{
+	const FString Path = Job.Org == EGenAIOrgs::Anthropic
+		? FString::Printf(TEXT("/v1/messages/batches/%s"), *Job.ProviderBatchId)
+		: FString::Printf(TEXT("/v1/batches/%s"), *Job.ProviderBatchId);
+	SendBatchRequest(Job.JobId, CreateRequest(Job.Org, TEXT("GET"), Path), false);
+}
+
+void UGenBatchJobSubsystem::SendCancel(const FGenBatchJobInfo& Job)
+{
+	UE_LOG(LogGenAI, Log, TEXT("Batch job %s: cancelling %s"), *Job.JobId, *Job.ProviderBatchId);
+	const FString Path = Job.Org == EGenAIOrgs::Anthropic
+		? FString::Printf(TEXT("/v1/messages/batches/%s/cancel"), *Job.ProviderBatchId)
+		: FString::Printf(TEXT("/v1/batches/%s/cancel"), *Job.ProviderBatchId);
+	SendBatchRequest(Job.JobId, CreateRequest(Job.Org, TEXT("POST"), Path), false);
+}
+
+void UGenBatchJobSubsystem::ApplyStatus(const FString& JobId, TConstArrayView<uint8> BatchJson)
+{
+	FGenBatchJobInfo* Job = FindJob(JobId);
+	if (!Job || Job->IsFinished() || Job->Status == EGenBatchJobStatus::Collecting)
+	{
+		return;
+	}
+
+	// Batch objects: https://platform.openai.com/docs/api-reference/batch/object, https://docs.anthropic.com/en/api/creating-message-batches
+	FGenJsonFieldQuery Id("id");
+	FGenJsonFieldQuery Status("status");
+	FGenJsonFieldQuery ProcessingStatus("processing_status");
+	FGenJsonFieldQuery OutputFileId("output_file_id");
+	FGenJsonFieldQuery ErrorFileId("error_file_id");
+	FGenJsonFieldQuery ResultsUrl("results_url");
+	FGenJsonFieldQuery ErrorMessage("errors.data.0.message");
+	FGenJsonFieldQuery* const Queries[] = {&Id, &Status, &ProcessingStatus, &OutputFileId, &ErrorFileId, &ResultsUrl, &ErrorMessage};
+	GenJson::ExtractFields(BatchJson, Queries);
+	if (!Id.IsString())
+	{
+		Finish(JobId, EGenBatchJobStatus::Failed, FString::Printf(TEXT("Unexpected batch object: %s"), *GenJson::ToDebugString(BatchJson)));
+		return;
+	}
+
+	const bool bCreated = Job->ProviderBatchId.IsEmpty();
+	Job->ProviderBatchId = Id.Value;
+	Job->ProviderStatus = Job->Org == EGenAIOrgs::Anthropic ? ProcessingStatus.Value : Status.Value;
+	if (bCreated)
+	{
+		Job->Status = EGenBatchJobStatus::InProgress;
+		UE_LOG(LogGenAI, Log, TEXT("Batch job %s: %d items submitted as %s"), *JobId, Job->NumItems, *Job->ProviderBatchId);
+	}
+
+	bool bEnded = false;
+	if (Job->Org == EGenAIOrgs::Anthropic)
+	{
+		if (Job->ProviderStatus == TEXT("ended"))
+		{
+			// Cancelled and expired requests are listed in the results as well
+			Job->ResultLocation = ResultsUrl.Value;
+			bEnded = true;
+		}
+	}
+	else if (Job->ProviderStatus == TEXT("failed"))
+	{
+		Finish(JobId, EGenBatchJobStatus::Failed, ErrorMessage.IsString() ? ErrorMessage.Value : TEXT("Batch failed validation"));
+		return;
+	}
+	else if (Job->ProviderStatus == TEXT("completed") || Job->ProviderStatus == TEXT("expired") || Job->ProviderStatus == TEXT("cancelled"))
+	{
+		// Expired and cancelled batches still report the requests that finished in time
+		Job->ResultLocation = OutputFileId.IsString() ? OutputFileId.Value : FString();
+		Job->ErrorLocation = ErrorFileId.IsString() ? ErrorFileId.Value : FString();
+		bEnded = true;
+	}
+
+	if (bEnded)
+	{
+		Job->Status = EGenBatchJobStatus::Collecting;
+		SaveJobs();
+		Collect(JobId, false);
+		return;
+	}
+
+	SaveJobs();
+	if (bCreated && Job->bCancelRequested)
+	{
+		SendCancel(*Job);
+	}
+}
+
+void UGenBatchJobSubsystem::Collect(const FString& JobId, bool bErrorFile)
+{
+	FGenBatchJobInfo* Job = FindJob(JobId);
+	if (!Job || Job->Status != EGenBatchJobStatus::Collecting)
+	{
+		return;
+	}
+	if (!bErrorFile && Job->bResultsDelivered)
+	{
+		Collect(JobId, true);
+		return;
+	}
+	if (!bErrorFile)
+	{
+		Job->NumSucceeded = 0;
+		Job->NumFailed = 0;
+	}
+
+	const FString& Location = bErrorFile ? Job->ErrorLocation : Job->ResultLocation;
+	if (Location.IsEmpty())
+	{
+		if (!bErrorFile && Job->Org == EGenAIOrgs::OpenAI)
+		{
+			Collect(JobId, true);
+			return;
+		}
+
+		EGenBatchJobStatus FinalStatus = EGenBatchJobStatus::Completed;
+		if (Job->ProviderStatus == TEXT("expired"))
+		{
+			FinalStatus = EGenBatchJobStatus::Expired;
+		}
+		else if (Job->ProviderStatus == TEXT("cancelled") || Job->bCancelRequested)
+		{
+			FinalStatus = EGenBatchJobStatus::Cancelled;
+		}
+		Finish(JobId, FinalStatus);
+		return;
+	}
+
+	const FString Path = Job->Org == EGenAIOrgs::Anthropic ? Location : FString::Printf(TEXT("/v1/files/%s/content"), *Location);
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateRequest(Job->Org, TEXT("GET"), Path);
+
+	Request->OnProcessRequestComplete().BindWeakLambda(this, [this, JobId, bErrorFile](FHttpRequestPtr, FHttpResponsePtr Response, bool bSucceeded)
+	{
+		BusyJobs.Remove(JobId);
+		if (!IsOkResponse(Response, bSucceeded))
+		{
+			// Stays in Collecting, the next tick starts the download over
+			UE_LOG(LogGenAI, Warning, TEXT("Batch job %s: downloading results failed, %s"), *JobId, *DescribeFailure(Response));
+			return;
+		}
+
+		// Parsed once the download is complete, the response content is still being written by the HTTP thread before that
+		DeliverResultLines(JobId, Response->GetContent());
+		if (!bErrorFile)
+		{
+			if (FGenBatchJobInfo* CollectedJob = FindJob(JobId))
+			{
+				CollectedJob->bResultsDelivered = true;
+				SaveJobs();
+			}
+			Collect(JobId, true);
+		}
+		else if (FGenBatchJobInfo* CollectedJob = FindJob(JobId))
+		{
+			CollectedJob->ErrorLocation.Reset();
+			Collect(JobId, true);
+		}
+	});
+
+	BusyJobs.Add(JobId);
+	Request->ProcessRequest();
+}
+
+void UGenBatchJobSubsystem::DeliverResultLines(const FString& JobId, TConstArrayView<uint8> Lines)
+{
+	const FGenBatchJobInfo* Job = FindJob(JobId);
+	if (!Job)
+	{
+		return;
+	}
+	const bool bAnthropic = Job->Org == EGenAIOrgs::Anthropic;
+
+	int32 LineStart = 0;
+	for (int32 Index = 0; Index <= Lines.Num(); ++Index)
+	{
+		if (Index < Lines.Num() && Lines[Index] != '\n')
+		{
+			continue;
+		}
+		const TConstArrayView<uint8> Line = Lines.Slice(LineStart, Index - LineStart);
+		LineStart = Index + 1;
+		if (Line.Num() == 0 || (Line.Num() == 1 && Line[0] == '\r'))
+		{
+			continue;
+		}
+
+		FGenJsonFieldQuery CustomId("custom_id");
+		if (bAnthropic)
+		{
+			// {"custom_id":..,"result":{"type":"succeeded","message":{..}}}, errored results nest the API error once more
+			FGenJsonFieldQuery ResultType("result.type");
+			FGenJsonFieldQuery Text("result.message.content.*.text");
+			FGenJsonFieldQuery ErrorMessage("result.error.error.message");
+			FGenJsonFieldQuery* const Queries[] = {&CustomId, &ResultType, &Text, &ErrorMessage};
+			GenJson::ExtractFields(Line, Queries);
+
+			const int32 ItemIndex = ParseCustomId(CustomId.Value);
+			if (ResultType.Value == TEXT("succeeded") && Text.IsString())
+			{
+				DeliverResult(JobId, ItemIndex, Text.Value, FString(), true);
+			}
+			else
+			{
+				DeliverResult(JobId, ItemIndex, FString(), ErrorMessage.IsString() ? ErrorMessage.Value : FString::Printf(TEXT("Request %s"), *ResultType.Value), false);
+			}
+		}
+		else
+		{
+			// {"custom_id":..,"response":{"status_code":200,"body":{chat completion}},"error":null}
+			FGenJsonFieldQuery StatusCode("response.status_code");
+			FGenJsonFieldQuery Content("response.body.choices.0.message.content");
+			FGenJsonFieldQuery BodyErrorMessage("response.body.error.message");
+			FGenJsonFieldQuery ErrorMessage("error.message");
+			FGenJsonFieldQuery* const Queries[] = {&CustomId, &StatusCode, &Content, &BodyErrorMessage, &ErrorMessage};
+			GenJson::ExtractFields(Line, Queries);
+
+			const int32 ItemIndex = ParseCustomId(CustomId.Value);
+			if (StatusCode.Value == TEXT("200") && Content.IsString())
+			{
+				DeliverResult(JobId, ItemIndex, Content.Value, FString(), true);
+			}
+			else
+			{
+				const FString Error = BodyErrorMessage.IsString() ? BodyErrorMessage.Value
+					: ErrorMessage.IsString() ? ErrorMessage.Value
+					: FString::Printf(TEXT("Request failed with status %s"), *StatusCode.Value);
+				DeliverResult(JobId, ItemIndex, FString(), Error, false);
+			}
+		}
+	}
+}
+
+void UGenBatchJobSubsystem::DeliverResult(const FString& JobId, int32 ItemIndex, const FString& Response, const FString& Error, bool bSuccess)
+{
+	FGenBatchJobInfo* Job = FindJob(JobId);
+	if (!Job || ItemIndex < 0 || ItemIndex >= Job->NumItems)
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Batch job %s: dropping result for unknown item %d"), *JobId, ItemIndex);
+		return;
+	}
+	if (bSuccess)
+	{
+		++Job->NumSucceeded;
+	}
+	else
+	{
+		++Job->NumFailed;
+	}
+
+	// Either delegate may cancel or remove jobs, Job is not touched past this point
+	if (const FJobCallbacks* JobCallbacks = Callbacks.Find(JobId))
+	{
+		JobCallbacks->OnItemResult.ExecuteIfBound(ItemIndex, Response, Error, bSuccess);
+	}
+	OnItemResult.Broadcast(JobId, ItemIndex, Response, Error, bSuccess);
+}
+
+void UGenBatchJobSubsystem::Finish(const FString& JobId, EGenBatchJobStatus Status, const FString& Error)
+{
+	FGenBatchJobInfo* Job = FindJob(JobId);
+	if (!Job || Job->IsFinished())
+	{
+		return;
+	}
+
+	Job->Status = Status;
+	Job->Error = Error;
+	if (Status == EGenBatchJobStatus::Failed)
+	{
+		UE_LOG(LogGenAI, Error, TEXT("Batch job %s failed: %s"), *JobId, *Error);
+	}
+	else
+	{
+		UE_LOG(LogGenAI, Log, TEXT("Batch job %s finished: %d succeeded, %d failed"), *JobId, Job->NumSucceeded, Job->NumFailed);
+	}
+	SaveJobs();
+
+	const FGenBatchJobInfo FinishedJob = *Job;
+	FJobCallbacks JobCallbacks;
+	Callbacks.RemoveAndCopyValue(JobId, JobCallbacks);
+	JobCallbacks.OnFinished.ExecuteIfBound(FinishedJob);
+	OnJobFinished.Broadcast(FinishedJob);
+}
+
+void UGenBatchJobSubsystem::FinishNextTick(const FString& JobId, EGenBatchJobStatus Status, const FString& Error)
+{
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this, JobId, Status, Error](float)
+	{
+		Finish(JobId, Status, Error);
+		return false;
+	}));
+}
+
+void UGenBatchJobSubsystem::LoadJobs()
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetJobsFilePath()))
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> JsonJobs;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonJobs))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Ignoring unreadable batch job list %s"), *GetJobsFilePath());
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& JsonJob : JsonJobs)
+	{
+		const TSharedPtr<FJsonObject>* JobObject;
+		FGenBatchJobInfo Job;
+		if (JsonJob->TryGetObject(JobObject) && FJsonObjectConverter::JsonObjectToUStruct(JobObject->ToSharedRef(), &Job) && !Job.JobId.IsEmpty())
+		{
+			Jobs.Add(MoveTemp(Job));
+		}
+	}
+}
+
+void UGenBatchJobSubsystem::SaveJobs() const
+{
+	TArray<TSharedPtr<FJsonValue>> JsonJobs;
+	JsonJobs.Reserve(Jobs.Num());
+	for (const FGenBatchJobInfo& Job : Jobs)
+	{
+		if (const TSharedPtr<FJsonObject> JobObject = FJsonObjectConverter::UStructToJsonObject(Job))
+		{
+			JsonJobs.Add(MakeShared<FJsonValueObject>(JobObject));
+		}
+	}
+
+	FString JsonString;
+	FJsonSerializer::Serialize(JsonJobs, TJsonWriterFactory<>::Create(&JsonString));
+	if (!FFileHelper::SaveStringToFile(JsonString, *GetJobsFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Failed to write batch job list %s"), *GetJobsFilePath());
+	}
+}
@@ -0,0 +1,275 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenCassette.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Compression.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Utilities/GenGlobalDefinitions.h"
+
+namespace
+{
+	constexpr uint32 CassetteMagic = 0x53414347; // "GCAS"
+	constexpr int32 CassetteVersion = 1;
+
+	void RunCassetteCommand(const TArray<FString>& Args)
+	{
+		FGenCassette& Cassette = FGenCassette::Get();
+		if (Args.Num() >= 2 && Args[0] == TEXT("record"))
+		{
+			Cassette.StartRecording(Args[1]);
+		}
+		else if (Args.Num() >= 2 && Args[0] == TEXT("replay"))
+		{
+			const float Speed = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 0.0f;
+			Cassette.StartReplay(Args[1], Speed, Args.Contains(TEXT("passthrough")));
+		}
+		else if (Args.Num() >= 1 && Args[0] == TEXT("stop"))
+		{
+			Cassette.Stop();
+		}
+		else
+		{
+			UE_LOG(LogGenAI, Display, TEXT("Usage: GenAI.Cassette record <Name> | replay <Name> [Speed] [passthrough] | stop"));
+		}
+	}
+
+	FAutoConsoleCommand GenAICassetteCommand(
+		TEXT("GenAI.Cassette"),
+		TEXT("Records provider traffic to a cassette or replays it without the network. Args: record <Name> | replay <Name> [Speed=0] [passthrough] | stop"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunCassetteCommand));
+}
+
+FArchive& operator<<(FArchive& Ar, FGenCassetteEntry& Entry)
+{
+	Ar << Entry.Key << Entry.Provider << Entry.Model;
+	Ar << Entry.bReceived << Entry.ResponseCode << Entry.bStream;
+	Ar << Entry.FirstByteSeconds << Entry.TotalSeconds;
+	Ar << Entry.Body << Entry.Chunks;
+	return Ar;
+}
+
+FGenCassette& FGenCassette::Get()
+{
+	static FGenCassette Instance;
+	return Instance;
+}
+
+FGenCassette::FGenCassette()
+{
+	// A recording in progress is written out when the process shuts down
+	FCoreDelegates::OnPreExit.AddLambda([]()
+	{
+		FGenCassette& Cassette = Get();
+		if (Cassette.Mode == EGenCassetteMode::Record)
+		{
+			Cassette.Stop();
+		}
+	});
+
+	FString NameOrPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("GenAICassetteRecord="), NameOrPath))
+	{
+		StartRecording(NameOrPath);
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("GenAICassetteReplay="), NameOrPath))
+	{
+		float Speed = 0.0f;
+		FParse::Value(FCommandLine::Get(), TEXT("GenAICassetteSpeed="), Speed);
+		StartReplay(NameOrPath, Speed, FParse::Param(FCommandLine::Get(), TEXT("GenAICassettePassthrough")));
+	}
+}
+
+FString FGenCassette::GetCassettePath(const FString& NameOrPath)
+{
+	if (NameOrPath.Contains(TEXT("/")) || NameOrPath.Contains(TEXT("\\")))
+	{
+		return NameOrPath;
+	}
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("GenAI"), TEXT("Cassettes"), NameOrPath + TEXT(".gencassette"));
+}
+
+bool FGenCassette::StartRecording(const FString& NameOrPath)
+{
+	Stop();
+	Path = GetCassettePath(NameOrPath);
+	Mode = EGenCassetteMode::Record;
+	UE_LOG(LogGenAI, Log, TEXT("Recording provider traffic to %s"), *Path);
+	return true;
+}
+
+bool FGenCassette::StartReplay(const FString& NameOrPath, float Speed, bool bInPassthrough)
+{
+	Stop();
+	if (!Load(GetCassettePath(NameOrPath)))
+	{
+		return false;
+	}
+	Mode = EGenCassetteMode::Replay;
+	ReplaySpeed = FMath::Max(Speed, 0.0f);
+	bPassthrough = bInPassthrough;
+	UE_LOG(LogGenAI, Log, TEXT("Replaying %d recorded responses from %s %s"), Order.Num(), *Path,
+	       ReplaySpeed > 0.0f ? *FString::Printf(TEXT("at %.2fx the recorded pace"), ReplaySpeed) : TEXT("as fast as possible"));
+	return true;
+}
+
+void FGenCassette::Stop()
+{
+	if (Mode == EGenCassetteMode::Record)
+	{
+		Save();
+	}
+	else if (Mode == EGenCassetteMode::Replay && Misses > 0)
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Cassette %s: %d requests had no recording"), *Path, Misses);
+	}
+
+	Mode = EGenCassetteMode::Off;
+	Entries.Reset();
+	Order.Reset();
+	ReplayCursors.Reset();
+	Misses = 0;
+	bPassthrough = false;
+}
+
+void FGenCassette::Record(FGenCassetteEntry&& Entry)
+{
+	if (Mode != EGenCassetteMode::Record)
+	{
+		return;
+	}
+	const TSharedRef<const FGenCassetteEntry> Recorded = MakeShared<const FGenCassetteEntry>(MoveTemp(Entry));
+	Entries.FindOrAdd(Recorded->Key).Add(Recorded);
+	Order.Add(Recorded);
+}
+
+TSharedPtr<const FGenCassetteEntry> FGenCassette::FindReplay(const FString& Key)
+{
+	const TArray<TSharedRef<const FGenCassetteEntry>>* Recordings = Mode == EGenCassetteMode::Replay ? Entries.Find(Key) : nullptr;
+	if (!Recordings || Recordings->Num() == 0)
+	{
+		++Misses;
+		return nullptr;
+	}
+	int32& Cursor = ReplayCursors.FindOrAdd(Key);
+	const TSharedRef<const FGenCassetteEntry>& Entry = (*Recordings)[Cursor % Recordings->Num()];
+	++Cursor;
+	return Entry;
+}
+
+bool FGenCassette::Save() const
+{
+	TArray<uint8> Uncompressed;
+	FMemoryWriter Writer(Uncompressed);
+	int32 NumEntries = Order.Num();
+	Writer << NumEntries;
+	for (const TSharedRef<const FGenCassetteEntry>& Entry : Order)
+	{
+		Writer << const_cast<FGenCassetteEntry&>(*Entry);
+	}
+
+	// Bodies are mostly JSON and SSE framing, which zlib shrinks to a fraction
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Uncompressed.Num());
+	TArray<uint8> File;
+	FMemoryWriter FileWriter(File);
+	uint32 Magic = CassetteMagic;
+	int32 Version = CassetteVersion;
+	int32 UncompressedSize = Uncompressed.Num();
+	FileWriter << Magic << Version << UncompressedSize;
+	const int32 HeaderSize = File.Num();
+	File.AddUninitialized(CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, File.GetData() + HeaderSize, CompressedSize, Uncompressed.GetData(), Uncompressed.Num()))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Could not compress cassette %s"), *Path);
+		return false;
+	}
+	File.SetNum(HeaderSize + CompressedSize);
+
+	if (!FFileHelper::SaveArrayToFile(File, *Path))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Could not write cassette %s"), *Path);
+		return false;
+	}
+	UE_LOG(LogGenAI, Log, TEXT("Wrote %d recorded responses to %s (%d bytes)"), Order.Num(), *Path, File.Num());
+	return true;
+}
+
+bool FGenCassette::Load(const FString& InPath)
+{
+	TArray<uint8> File;
+	if (!FFileHelper::LoadFileToArray(File, *InPath))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Could not read cassette %s"), *InPath);
+		return false;
+	}
+
+	FMemoryReader FileReader(File);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 UncompressedSize = 0;
+	FileReader << Magic << Version << UncompressedSize;
+	if (FileReader.IsError() || Magic != CassetteMagic || Version != CassetteVersion || UncompressedSize < 0)
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("%s is not a cassette of this plugin version"), *InPath);
+		return false;
+	}
+
+	TArray<uint8> Uncompressed;
+	Uncompressed.SetNumUninitialized(UncompressedSize);
+	const int64 HeaderSize = FileReader.Tell();
+	if (!FCompression::UncompressMemory(NAME_Zlib, Uncompressed.GetData(), UncompressedSize, File.GetData() + HeaderSize, File.Num() - HeaderSize))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Cassette %s is corrupt"), *InPath);
+		return false;
+	}
+
+	FMemoryReader Reader(Uncompressed);
+	int32 NumEntries = 0;
+	Reader << NumEntries;
+	for (int32 Index = 0; Index < NumEntries && !Reader.IsError(); ++Index)
+	{
+		FGenCassetteEntry Entry;
+		Reader << Entry;
+		const TSharedRef<const FGenCassetteEntry> Loaded = MakeShared<const FGenCassetteEntry>(MoveTemp(Entry));
+		Entries.FindOrAdd(Loaded->Key).Add(Loaded);
+		Order.Add(Loaded);
+	}
+	if (Reader.IsError())
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Cassette %s is truncated"), *InPath);
+		Entries.Reset();
+		Order.Reset();
+		return false;
+	}
+
+	Path = InPath;
+	return true;
+}
+
+bool UGenCassetteLibrary::StartCassetteRecording(const FString& NameOrPath)
+{
+	return FGenCassette::Get().StartRecording(NameOrPath);
+}
+
+bool UGenCassetteLibrary::StartCassetteReplay(const FString& NameOrPath, float Speed, bool bPassthrough)
+{
+	return FGenCassette::Get().StartReplay(NameOrPath, Speed, bPassthrough);
+}
+
+void UGenCassetteLibrary::StopCassette()
+{
+	FGenCassette::Get().Stop();
+}
+
+EGenCassetteMode UGenCassetteLibrary::GetCassetteMode()
+{
+	return FGenCassette::Get().GetMode();
+}
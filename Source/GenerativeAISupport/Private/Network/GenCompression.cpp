@@ -0,0 +1,176 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenCompression.h"
+
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "Utilities/GenTrace.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+	// Adding 16 to the window bits selects the gzip wrapper, adding 32 detects gzip or zlib when inflating
+	constexpr int32 GzipWindowBits = MAX_WBITS + 16;
+	constexpr int32 AutoDetectWindowBits = MAX_WBITS + 32;
+
+	// JSON shrinks four to six times at the fastest level already, higher levels mostly cost game thread time
+	constexpr int32 CompressionLevel = Z_BEST_SPEED;
+
+	constexpr int32 InflateChunkSize = 16 * 1024;
+
+	// Game thread only, like the request engine that feeds it
+	FGenCompressionStats& GetMutableStats()
+	{
+		static FGenCompressionStats Stats;
+		return Stats;
+	}
+}
+
+FGenStreamInflater::FGenStreamInflater()
+	: Stream(new z_stream())
+{
+	FMemory::Memzero(*Stream);
+	bFailed = inflateInit2(Stream, AutoDetectWindowBits) != Z_OK;
+}
+
+FGenStreamInflater::~FGenStreamInflater()
+{
+	if (!bFailed)
+	{
+		inflateEnd(Stream);
+	}
+	delete Stream;
+}
+
+bool FGenStreamInflater::Inflate(const uint8* Data, int64 Num, TArray<uint8>& OutData)
+{
+	OutData.Reset();
+	if (bFailed)
+	{
+		return false;
+	}
+	if (bStreamEnded)
+	{
+		return true;
+	}
+
+	Stream->next_in = const_cast<Bytef*>(Data);
+	Stream->avail_in = static_cast<uInt>(Num);
+	Stream->avail_out = 0;
+	// A full output chunk means inflate may still hold decoded bytes, even with all input consumed
+	while (Stream->avail_in > 0 || Stream->avail_out == 0)
+	{
+		const int32 Offset = OutData.AddUninitialized(InflateChunkSize);
+		Stream->next_out = OutData.GetData() + Offset;
+		Stream->avail_out = InflateChunkSize;
+
+		const int32 Result = inflate(Stream, Z_NO_FLUSH);
+		OutData.SetNum(OutData.Num() - static_cast<int32>(Stream->avail_out), EAllowShrinking::No);
+		if (Result == Z_STREAM_END)
+		{
+			bStreamEnded = true;
+			break;
+		}
+		if (Result != Z_OK && Result != Z_BUF_ERROR)
+		{
+			bFailed = true;
+			inflateEnd(Stream);
+			return false;
+		}
+		if (Result == Z_BUF_ERROR)
+		{
+			// Needs more input than this chunk carries
+			break;
+		}
+	}
+
+	TotalOut += OutData.Num();
+	return true;
+}
+
+bool FGenCompression::ShouldCompressRequest(EGenAIOrgs Org, int32 NumBytes)
+{
+	const UGenerativeAISupportRuntimeSettings* Settings = GetDefault<UGenerativeAISupportRuntimeSettings>();
+	return NumBytes >= Settings->RequestCompressionMinBytes && Settings->CompressRequestProviders.Contains(Org);
+}
+
+bool FGenCompression::GzipCompress(TConstArrayView<uint8> Data, TArray<uint8>& OutCompressed)
+{
+	z_stream Stream;
+	FMemory::Memzero(Stream);
+	if (deflateInit2(&Stream, CompressionLevel, Z_DEFLATED, GzipWindowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+	{
+		return false;
+	}
+
+	OutCompressed.SetNumUninitialized(static_cast<int32>(deflateBound(&Stream, Data.Num())));
+	Stream.next_in = const_cast<Bytef*>(Data.GetData());
+	Stream.avail_in = Data.Num();
+	Stream.next_out = OutCompressed.GetData();
+	Stream.avail_out = OutCompressed.Num();
+
+	const int32 Result = deflate(&Stream, Z_FINISH);
+	deflateEnd(&Stream);
+	if (Result != Z_STREAM_END)
+	{
+		OutCompressed.Reset();
+		return false;
+	}
+	OutCompressed.SetNum(static_cast<int32>(Stream.total_out), EAllowShrinking::No);
+	return true;
+}
+
+bool FGenCompression::IsGzip(TConstArrayView<uint8> Data)
+{
+	return Data.Num() >= 2 && Data[0] == 0x1f && Data[1] == 0x8b;
+}
+
+bool FGenCompression::Inflate(TConstArrayView<uint8> Data, TArray<uint8>& OutData)
+{
+	GENAI_TRACE_SCOPE("GenAI::InflateResponse");
+	FGenStreamInflater Inflater;
+	return Inflater.Inflate(Data.GetData(), Data.Num(), OutData);
+}
+
+void FGenCompression::RecordRequest(int64 Bytes, int64 WireBytes)
+{
+	FGenCompressionStats& Stats = GetMutableStats();
+	Stats.RequestBytes += Bytes;
+	Stats.RequestWireBytes += WireBytes;
+	Stats.CompressedRequests += WireBytes != Bytes ? 1 : 0;
+}
+
+void FGenCompression::RecordResponse(int64 WireBytes, int64 Bytes)
+{
+	FGenCompressionStats& Stats = GetMutableStats();
+	Stats.ResponseWireBytes += WireBytes;
+	Stats.ResponseBytes += Bytes;
+	Stats.CompressedResponses += WireBytes != Bytes ? 1 : 0;
+}
+
+FGenCompressionStats FGenCompression::GetStats()
+{
+	FGenCompressionStats Stats = GetMutableStats();
+	Stats.RequestRatio = Stats.RequestBytes > 0 ? static_cast<float>(static_cast<double>(Stats.RequestWireBytes) / Stats.RequestBytes) : 1.0f;
+	Stats.ResponseRatio = Stats.ResponseBytes > 0 ? static_cast<float>(static_cast<double>(Stats.ResponseWireBytes) / Stats.ResponseBytes) : 1.0f;
+	return Stats;
+}
+
+void FGenCompression::ResetStats()
+{
+	GetMutableStats() = FGenCompressionStats();
+}
+
+FGenCompressionStats UGenCompressionLibrary::GetCompressionStats()
+{
+	return FGenCompression::GetStats();
+}
+
+void UGenCompressionLibrary::ResetCompressionStats()
+{
+	FGenCompression::ResetStats();
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenConnectionWarmer.h"
+
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Secure/GenSecureKey.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utilities/GenGlobalDefinitions.h"
+
+namespace
+{
+	// Keys can be set at any time, the ticker picks up newly configured providers on its next run
+	constexpr float TickIntervalSeconds = 5.0f;
+}
+
+FGenConnectionWarmer& FGenConnectionWarmer::Get()
+{
+	static FGenConnectionWarmer Instance;
+	return Instance;
+}
+
+void FGenConnectionWarmer::Start()
+{
+	if (TickHandle.IsValid() || IsRunningCommandlet())
+	{
+		return;
+	}
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGenConnectionWarmer::Tick), TickIntervalSeconds);
+	// Loading a map blocks the game thread long enough for idle connections to time out
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddLambda([this](UWorld*) { WarmAll(); });
+	WarmAll();
+}
+
+void FGenConnectionWarmer::Stop()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	TickHandle.Reset();
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	PostLoadMapHandle.Reset();
+}
+
+void FGenConnectionWarmer::WarmAll()
+{
+	for (const EGenAIOrgs Org : GetDefault<UGenerativeAISupportRuntimeSettings>()->WarmConnectionProviders)
+	{
+		if (!Hosts.FindOrAdd(Org).bPingInFlight && !UGenSecureKey::GetGenerativeAIApiKey(Org).IsEmpty())
+		{
+			Ping(Org);
+		}
+	}
+}
+
+bool FGenConnectionWarmer::Tick(float DeltaTime)
+{
+	const UGenerativeAISupportRuntimeSettings* Settings = GetDefault<UGenerativeAISupportRuntimeSettings>();
+	const double Now = FPlatformTime::Seconds();
+	for (const EGenAIOrgs Org : Settings->WarmConnectionProviders)
+	{
+		const FHostState& Host = Hosts.FindOrAdd(Org);
+		const bool bNeverWarmed = Host.LastPingTime < 0.0;
+		const bool bKeepAliveDue = Settings->ConnectionKeepAliveSeconds > 0.0f && Now - Host.LastPingTime >= Settings->ConnectionKeepAliveSeconds;
+		if (!Host.bPingInFlight && (bNeverWarmed || bKeepAliveDue) && !UGenSecureKey::GetGenerativeAIApiKey(Org).IsEmpty())
+		{
+			Ping(Org);
+		}
+	}
+	return true;
+}
+
+void FGenConnectionWarmer::Ping(EGenAIOrgs Org)
+{
+	const FString BaseUrl = GetDefault<UGenerativeAISupportRuntimeSettings>()->GetBaseUrl(Org);
+	if (BaseUrl.IsEmpty())
+	{
+		return;
+	}
+
+	FHostState& Host = Hosts.FindOrAdd(Org);
+	Host.bPingInFlight = true;
+	Host.LastPingTime = FPlatformTime::Seconds();
+
+	// Any answer means the connection is up, no credentials are needed for that and none are sent
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+	Request->SetVerb(TEXT("HEAD"));
+	Request->SetURL(BaseUrl + TEXT("/"));
+	Request->SetTimeout(10.0f);
+	Request->OnProcessRequestComplete().BindLambda([Org, StartTime = Host.LastPingTime](FHttpRequestPtr, FHttpResponsePtr Response, bool bSucceeded)
+	{
+		FGenConnectionWarmer& Warmer = Get();
+		FHostState& State = Warmer.Hosts.FindOrAdd(Org);
+		State.bPingInFlight = false;
+
+		const FString OrgName = UEnum::GetDisplayValueAsText(Org).ToString();
+		if (!bSucceeded || !Response.IsValid())
+		{
+			UE_LOG(LogGenAIVerbose, Log, TEXT("Connection warm-up for %s failed"), *OrgName);
+			return;
+		}
+
+		const double PingMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		if (State.ColdPingMs < 0.0)
+		{
+			// Ping once more over the now open connection, the difference is what the first real request would have paid
+			State.ColdPingMs = PingMs;
+			Warmer.Ping(Org);
+		}
+		else if (!State.bSavingsReported)
+		{
+			State.bSavingsReported = true;
+			UE_LOG(LogGenPerformance, Display, TEXT("Warmed connection to %s: cold %.0f ms, warm %.0f ms, %.0f ms of connection setup saved on the first request"),
+			       *OrgName, State.ColdPingMs, PingMs, FMath::Max(0.0, State.ColdPingMs - PingMs));
+		}
+		else
+		{
+			UE_LOG(LogGenAIVerbose, Log, TEXT("Keep-alive ping to %s took %.0f ms"), *OrgName, PingMs);
+		}
+	});
+	Request->ProcessRequest();
+}
@@ -0,0 +1,267 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+// Load test through the real request engine, meant to run against Content/Python/mock_provider_server.py with
+// -GenAIBaseUrl=http://127.0.0.1:8080 (or the Endpoints settings) so thousands of requests cost nothing.
+// "GenAI.Bench.Load [Provider] [Requests] [Concurrency] [Stream] [MaxTokens]" keeps Concurrency requests outstanding until
+// Requests have completed, then logs throughput, failures and the GenAI.Stats percentiles. "GenAI.Bench.Load stop" aborts.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/IConsoleManager.h"
+#include "Network/GenProviderTraits.h"
+#include "Network/GenRequestEngine.h"
+#include "Network/GenRequestMetrics.h"
+#include "Utilities/GenGlobalDefinitions.h"
+
+namespace
+{
+	enum class ELoadTestProvider : uint8
+	{
+		OpenAI,
+		Structured,
+		Claude,
+		DeepSeek,
+		XAI
+	};
+
+	struct FLoadTestRun
+	{
+		ELoadTestProvider Provider = ELoadTestProvider::OpenAI;
+		int32 Requests = 0;
+		int32 Concurrency = 0;
+		bool bStream = false;
+		int32 MaxTokens = 0;
+
+		int32 Started = 0;
+		int32 Succeeded = 0;
+		int32 Failed = 0;
+		int64 Deltas = 0;
+		double StartTime = 0.0;
+		bool bStopped = false;
+		// Set while StartNext loops, requests failing inside Send must not recurse into it
+		bool bStarting = false;
+
+		// Error message to how often it came back
+		TMap<FString, int32> Errors;
+		TMap<int32, FGenRequestHandle> Pending;
+	};
+
+	TSharedPtr<FLoadTestRun> ActiveRun;
+
+	// Distinct per request, identical prompts would be served by coalescing instead of going out
+	TArray<FGenChatMessage> MakeMessages(int32 Index)
+	{
+		TArray<FGenChatMessage> Messages;
+		FGenChatMessage& System = Messages.AddDefaulted_GetRef();
+		System.Role = TEXT("system");
+		System.Content = TEXT("You are a load test. Answer briefly.");
+		FGenChatMessage& User = Messages.AddDefaulted_GetRef();
+		User.Role = TEXT("user");
+		User.Content = FString::Printf(TEXT("Load test request %d, describe a random item."), Index);
+		return Messages;
+	}
+
+	FGenRequestOptions MakeOptions()
+	{
+		FGenRequestOptions Options;
+		Options.CachePolicy = EGenCachePolicy::Bypass;
+		Options.bCoalesceIdenticalRequests = false;
+		return Options;
+	}
+
+	FGenRequestHandle SendOne(const FLoadTestRun& Run, int32 Index, FGenResponseCallback ResponseCallback, FGenDeltaCallback DeltaCallback)
+	{
+		switch (Run.Provider)
+		{
+		case ELoadTestProvider::Structured:
+			{
+				FGenOAIStructuredChatSettings Settings;
+				Settings.ChatSettings.MaxTokens = Run.MaxTokens;
+				Settings.ChatSettings.Messages = MakeMessages(Index);
+				Settings.ChatSettings.RequestOptions = MakeOptions();
+				Settings.Name = TEXT("item");
+				Settings.SchemaJson = TEXT("{\"type\":\"object\",\"properties\":{\"name\":{\"type\":\"string\"},\"weight\":{\"type\":\"number\"},\"tags\":{\"type\":\"array\",\"items\":{\"type\":\"string\"}}},\"required\":[\"name\",\"weight\",\"tags\"]}");
+				return TGenRequestEngine<FGenOpenAIStructuredTraits>::Send(Settings, MoveTemp(ResponseCallback));
+			}
+		case ELoadTestProvider::Claude:
+			{
+				FGenClaudeChatSettings Settings;
+				Settings.MaxTokens = Run.MaxTokens;
+				Settings.Messages = MakeMessages(Index);
+				Settings.bStreamResponse = Run.bStream;
+				Settings.RequestOptions = MakeOptions();
+				return TGenRequestEngine<FGenClaudeChatTraits>::Send(Settings, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+			}
+		case ELoadTestProvider::DeepSeek:
+			{
+				FGenDSeekChatSettings Settings;
+				Settings.MaxTokens = Run.MaxTokens;
+				Settings.Messages = MakeMessages(Index);
+				Settings.bStreamResponse = Run.bStream;
+				Settings.RequestOptions = MakeOptions();
+				return TGenRequestEngine<FGenDeepSeekChatTraits>::Send(Settings, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+			}
+		case ELoadTestProvider::XAI:
+			{
+				FGenXAIChatSettings Settings;
+				Settings.MaxTokens = Run.MaxTokens;
+				for (const FGenChatMessage& Message : MakeMessages(Index))
+				{
+					FGenXAIMessage& XAIMessage = Settings.Messages.AddDefaulted_GetRef();
+					XAIMessage.Role = Message.Role;
+					XAIMessage.Content = Message.Content;
+				}
+				Settings.bStreamResponse = Run.bStream;
+				Settings.RequestOptions = MakeOptions();
+				return TGenRequestEngine<FGenXAIChatTraits>::Send(Settings, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+			}
+		default:
+			{
+				FGenChatSettings Settings;
+				Settings.MaxTokens = Run.MaxTokens;
+				Settings.Messages = MakeMessages(Index);
+				Settings.bStreamResponse = Run.bStream;
+				Settings.RequestOptions = MakeOptions();
+				return TGenRequestEngine<FGenOpenAIChatTraits>::Send(Settings, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+			}
+		}
+	}
+
+	void Report(const FLoadTestRun& Run)
+	{
+		const double Seconds = FPlatformTime::Seconds() - Run.StartTime;
+		const int32 Completed = Run.Succeeded + Run.Failed;
+		UE_LOG(LogGenPerformance, Display, TEXT("Load test%s: %d of %d requests in %.2f s, %.1f requests/s, %d succeeded, %d failed, %lld stream deltas"),
+		       Run.bStopped ? TEXT(" (stopped)") : TEXT(""), Completed, Run.Requests, Seconds, Seconds > 0.0 ? Completed / Seconds : 0.0,
+		       Run.Succeeded, Run.Failed, Run.Deltas);
+		for (const TPair<FString, int32>& Error : Run.Errors)
+		{
+			UE_LOG(LogGenPerformance, Display, TEXT("  %6d x %s"), Error.Value, *Error.Key.Left(200));
+		}
+		FGenRequestMetrics::LogSummaries();
+	}
+
+	void StartNext(const TSharedRef<FLoadTestRun>& Run)
+	{
+		TGuardValue<bool> StartingGuard(Run->bStarting, true);
+		while (!Run->bStopped && Run->Started < Run->Requests && Run->Pending.Num() < Run->Concurrency)
+		{
+			const int32 Index = Run->Started++;
+			const TWeakPtr<FLoadTestRun> WeakRun = Run;
+			FGenRequestHandle Handle = SendOne(*Run, Index,
+				[WeakRun, Index](const FString& Response, const FString& Error, bool bSuccess)
+				{
+					const TSharedPtr<FLoadTestRun> Pinned = WeakRun.Pin();
+					if (!Pinned.IsValid() || Pinned != ActiveRun)
+					{
+						return;
+					}
+					Pinned->Pending.Remove(Index);
+					if (bSuccess)
+					{
+						++Pinned->Succeeded;
+					}
+					else
+					{
+						++Pinned->Failed;
+						++Pinned->Errors.FindOrAdd(Error);
+					}
+
+					if (Pinned->Succeeded + Pinned->Failed >= Pinned->Requests)
+					{
+						ActiveRun.Reset();
+						Report(*Pinned);
+						return;
+					}
+					if (!Pinned->bStarting)
+					{
+						StartNext(Pinned.ToSharedRef());
+					}
+				},
+				Run->bStream
+					? FGenDeltaCallback([WeakRun](const FGenChatStreamDelta&)
+					{
+						if (const TSharedPtr<FLoadTestRun> Pinned = WeakRun.Pin())
+						{
+							++Pinned->Deltas;
+						}
+					})
+					: FGenDeltaCallback());
+
+			// The request may already have completed, payload errors and missing keys fail inside Send
+			if (Handle.IsPending())
+			{
+				Run->Pending.Add(Index, MoveTemp(Handle));
+			}
+		}
+	}
+
+	void RunLoadTest(const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0 && Args[0] == TEXT("stop"))
+		{
+			if (const TSharedPtr<FLoadTestRun> Run = ActiveRun)
+			{
+				ActiveRun.Reset();
+				Run->bStopped = true;
+				for (TPair<int32, FGenRequestHandle>& Pending : Run->Pending)
+				{
+					Pending.Value.Cancel();
+				}
+				Report(*Run);
+			}
+			return;
+		}
+		if (ActiveRun.IsValid())
+		{
+			UE_LOG(LogGenPerformance, Warning, TEXT("A load test is already running, \"GenAI.Bench.Load stop\" aborts it"));
+			return;
+		}
+
+		const TSharedRef<FLoadTestRun> Run = MakeShared<FLoadTestRun>();
+		const FString Provider = Args.Num() > 0 ? Args[0] : TEXT("openai");
+		if (Provider == TEXT("structured"))
+		{
+			Run->Provider = ELoadTestProvider::Structured;
+		}
+		else if (Provider == TEXT("claude") || Provider == TEXT("anthropic"))
+		{
+			Run->Provider = ELoadTestProvider::Claude;
+		}
+		else if (Provider == TEXT("deepseek"))
+		{
+			Run->Provider = ELoadTestProvider::DeepSeek;
+		}
+		else if (Provider == TEXT("xai"))
+		{
+			Run->Provider = ELoadTestProvider::XAI;
+		}
+		else if (Provider != TEXT("openai"))
+		{
+			UE_LOG(LogGenPerformance, Warning, TEXT("Unknown load test provider %s, expected openai, structured, claude, deepseek or xai"), *Provider);
+			return;
+		}
+		Run->Requests = FMath::Max(1, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1000);
+		Run->Concurrency = FMath::Max(1, Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 32);
+		Run->bStream = Args.Num() > 3 && FCString::ToBool(*Args[3]);
+		Run->MaxTokens = FMath::Max(1, Args.Num() > 4 ? FCString::Atoi(*Args[4]) : 128);
+
+		UE_LOG(LogGenPerformance, Display, TEXT("Load test: %d %s requests, %d concurrent%s"), Run->Requests, *Provider, Run->Concurrency,
+		       Run->bStream ? TEXT(", streamed") : TEXT(""));
+		FGenRequestMetrics::Reset();
+		ActiveRun = Run;
+		Run->StartTime = FPlatformTime::Seconds();
+		StartNext(Run);
+	}
+
+	FAutoConsoleCommand GenAIBenchLoadCommand(
+		TEXT("GenAI.Bench.Load"),
+		TEXT("Drives requests through the request engine, point it at mock_provider_server.py first. Args: [openai|structured|claude|deepseek|xai] [Requests=1000] [Concurrency=32] [Stream=0] [MaxTokens=128], or stop"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunLoadTest));
+}
+
+#endif // !UE_BUILD_SHIPPING
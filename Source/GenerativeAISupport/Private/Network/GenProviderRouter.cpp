@@ -0,0 +1,581 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenProviderRouter.h"
+
+#include "Algo/StableSort.h"
+#include "Containers/Ticker.h"
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "Network/GenProviderTraits.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenUtils.h"
+
+namespace
+{
+	// Weight of the newest sample, the latency follows a slowing provider within a handful of requests
+	constexpr double LatencyAlpha = 0.2;
+	constexpr double ErrorAlpha = 0.1;
+
+	constexpr int32 LatencyWindow = 64;
+	constexpr int32 MinSamplesForP95 = 8;
+
+	// Keeps a backend that fails most requests from scoring as infinitely slow, it still ranks behind every healthy one
+	constexpr double MinSuccessRate = 0.05;
+
+	FString DescribeBackend(const FGenRouteBackend& Backend)
+	{
+		return UEnum::GetDisplayValueAsText(Backend.Org).ToString() + TEXT(" ") + Backend.Model;
+	}
+
+	// DeepSeek settings take an enum, the backend's model name has to be one of its display names
+	bool TryResolveDeepSeekModel(const FString& ModelName, EDeepSeekModels& OutModel)
+	{
+		const UEnum* Enum = StaticEnum<EDeepSeekModels>();
+		for (int32 Index = 0; Index < Enum->NumEnums() - 1; ++Index)
+		{
+			const EDeepSeekModels Model = static_cast<EDeepSeekModels>(Enum->GetValueByIndex(Index));
+			if (Model != EDeepSeekModels::Unknown && UGenUtils::GetEnumDisplayName(Enum, static_cast<int32>(Model)) == ModelName)
+			{
+				OutModel = Model;
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+/**
+ * State of one routed request, shared by the callbacks of its attempts
+ */
+struct FGenRoutedRequest
+{
+	struct FAttempt
+	{
+		FGenRouteBackend Backend;
+		FGenRequestHandle Handle;
+		double StartTime = 0.0;
+		bool bHedge = false;
+		bool bProbe = false;
+		bool bDone = false;
+	};
+
+	FGenRoutedChatSettings Settings;
+	FGenResponseCallback ResponseCallback;
+	FGenDeltaCallback DeltaCallback;
+
+	TArray<FAttempt> Attempts;
+	// Backends not tried yet, best first
+	TArray<FGenRouteBackend> Remaining;
+
+	// First attempt that streamed a delta or answered, the only one allowed to reach the caller
+	int32 Winner = INDEX_NONE;
+	FTSTicker::FDelegateHandle HedgeTimer;
+	FString LastError;
+	bool bCompleted = false;
+
+	// Deadline and token apply to the routed request as a whole, its attempts are sent without them
+	FTSTicker::FDelegateHandle DeadlineTimer;
+	FGenCancellationToken CancellationToken;
+	FDelegateHandle CancellationBinding;
+
+	int32 GetNumPending() const
+	{
+		int32 NumPending = 0;
+		for (const FAttempt& Attempt : Attempts)
+		{
+			NumPending += Attempt.bDone ? 0 : 1;
+		}
+		return NumPending;
+	}
+
+	bool CanStartAttempt() const { return Remaining.Num() > 0 && Attempts.Num() < Settings.MaxAttempts; }
+
+	void ReleaseTimers()
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(HedgeTimer);
+		HedgeTimer.Reset();
+		FTSTicker::GetCoreTicker().RemoveTicker(DeadlineTimer);
+		DeadlineTimer.Reset();
+		CancellationToken.RemoveOnCancelled(CancellationBinding);
+		CancellationBinding.Reset();
+	}
+};
+
+void FGenRoutedRequestHandle::Cancel()
+{
+	if (const TSharedPtr<FGenRoutedRequest> Pinned = Request.Pin(); Pinned && !Pinned->bCompleted)
+	{
+		Pinned->bCompleted = true;
+		Pinned->ReleaseTimers();
+		FGenProviderRouter::Get().CancelAttempts(*Pinned, INDEX_NONE, false);
+	}
+}
+
+bool FGenRoutedRequestHandle::IsPending() const
+{
+	const TSharedPtr<FGenRoutedRequest> Pinned = Request.Pin();
+	return Pinned && !Pinned->bCompleted;
+}
+
+void FGenProviderRouter::FBackendState::AddLatency(double Seconds)
+{
+	LatencyEwma = RecentLatencies.Num() == 0 ? Seconds : LatencyEwma + LatencyAlpha * (Seconds - LatencyEwma);
+	if (RecentLatencies.Num() < LatencyWindow)
+	{
+		RecentLatencies.Add(static_cast<float>(Seconds));
+	}
+	else
+	{
+		RecentLatencies[NextLatencySlot] = static_cast<float>(Seconds);
+		NextLatencySlot = (NextLatencySlot + 1) % LatencyWindow;
+	}
+}
+
+double FGenProviderRouter::FBackendState::GetP95Latency() const
+{
+	if (RecentLatencies.Num() == 0)
+	{
+		return 0.0;
+	}
+	TArray<float> Sorted = RecentLatencies;
+	Sorted.Sort();
+	return Sorted[FMath::CeilToInt32(Sorted.Num() * 0.95) - 1];
+}
+
+FGenProviderRouter& FGenProviderRouter::Get()
+{
+	static FGenProviderRouter Router;
+	return Router;
+}
+
+FGenRoutedRequestHandle FGenProviderRouter::Send(const FGenRoutedChatSettings& Settings, FGenResponseCallback ResponseCallback,
+                                                 FGenDeltaCallback DeltaCallback)
+{
+	const TSharedRef<FGenRoutedRequest> Request = MakeShared<FGenRoutedRequest>();
+	Request->Settings = Settings;
+	Request->ResponseCallback = MoveTemp(ResponseCallback);
+	Request->DeltaCallback = MoveTemp(DeltaCallback);
+	FGenRoutedRequestHandle Handle(Request);
+
+	const FGenRequestOptions& Options = Settings.RequestOptions;
+	if (Options.CancellationToken.IsCancelled())
+	{
+		Finish(Request, FString(), TEXT("Request cancelled"), false);
+		return Handle;
+	}
+	const TWeakPtr<FGenRoutedRequest> WeakRequest = Request;
+	if (Options.DeadlineSeconds > 0.0f)
+	{
+		const float DeadlineSeconds = Options.DeadlineSeconds;
+		Request->DeadlineTimer = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakRequest, DeadlineSeconds](float)
+		{
+			if (const TSharedPtr<FGenRoutedRequest> Pinned = WeakRequest.Pin())
+			{
+				Pinned->DeadlineTimer.Reset();
+			}
+			Get().Abort(WeakRequest, FString::Printf(TEXT("Request deadline of %.1f s exceeded"), DeadlineSeconds));
+			return false;
+		}), DeadlineSeconds);
+	}
+	if (Options.CancellationToken.IsValid())
+	{
+		Request->CancellationToken = Options.CancellationToken;
+		Request->CancellationBinding = Options.CancellationToken.AddOnCancelled(FSimpleDelegate::CreateLambda([WeakRequest]()
+		{
+			Get().Abort(WeakRequest, TEXT("Request cancelled"));
+		}));
+	}
+
+	Request->Remaining = RankBackends(Settings.Backends, FPlatformTime::Seconds());
+	if (Request->Remaining.Num() == 0)
+	{
+		Finish(Request, FString(), Settings.Backends.Num() > 0 ? TEXT("Every backend's circuit breaker is open") : TEXT("No backends to route to"), false);
+		return Handle;
+	}
+
+	StartAttempt(Request, false);
+	return Handle;
+}
+
+TArray<FGenBackendHealth> FGenProviderRouter::GetHealth() const
+{
+	TArray<FGenBackendHealth> Health;
+	Health.Reserve(States.Num());
+	for (const TPair<FBackendKey, FBackendState>& Pair : States)
+	{
+		const FBackendState& State = Pair.Value;
+		FGenBackendHealth& Entry = Health.AddDefaulted_GetRef();
+		Entry.Backend.Org = Pair.Key.Key;
+		Entry.Backend.Model = Pair.Key.Value;
+		Entry.Requests = State.Requests;
+		Entry.Failures = State.Failures;
+		Entry.LatencySeconds = static_cast<float>(State.LatencyEwma);
+		Entry.ErrorRate = static_cast<float>(State.ErrorRate);
+		Entry.P95LatencySeconds = static_cast<float>(State.GetP95Latency());
+		Entry.HedgesStarted = State.HedgesStarted;
+		Entry.HedgesWon = State.HedgesWon;
+		Entry.bCircuitOpen = State.Circuit != ECircuitState::Closed;
+	}
+	return Health;
+}
+
+void FGenProviderRouter::ResetHealth()
+{
+	States.Reset();
+}
+
+TArray<FGenRouteBackend> FGenProviderRouter::RankBackends(TConstArrayView<FGenRouteBackend> Backends, double Now)
+{
+	TArray<TPair<double, FGenRouteBackend>> Scored;
+	for (const FGenRouteBackend& Backend : Backends)
+	{
+		FBackendState& State = States.FindOrAdd(MakeKey(Backend));
+		if (!IsAvailable(State, Now) || Scored.ContainsByPredicate([&Backend](const TPair<double, FGenRouteBackend>& Entry) { return Entry.Value == Backend; }))
+		{
+			continue;
+		}
+		// Unmeasured backends score 0 and get tried in the listed order, that is how they get measured
+		const double Score = State.RecentLatencies.Num() > 0 ? State.LatencyEwma / FMath::Max(1.0 - State.ErrorRate, MinSuccessRate) : 0.0;
+		Scored.Emplace(Score, Backend);
+	}
+	Algo::StableSortBy(Scored, [](const TPair<double, FGenRouteBackend>& Entry) { return Entry.Key; });
+
+	TArray<FGenRouteBackend> Ranked;
+	Ranked.Reserve(Scored.Num());
+	for (TPair<double, FGenRouteBackend>& Entry : Scored)
+	{
+		Ranked.Add(MoveTemp(Entry.Value));
+	}
+	return Ranked;
+}
+
+bool FGenProviderRouter::IsAvailable(FBackendState& State, double Now)
+{
+	if (State.Circuit == ECircuitState::Open && Now >= State.OpenUntil)
+	{
+		State.Circuit = ECircuitState::HalfOpen;
+	}
+	return State.Circuit == ECircuitState::Closed || (State.Circuit == ECircuitState::HalfOpen && !State.bProbeInFlight);
+}
+
+void FGenProviderRouter::StartAttempt(const TSharedRef<FGenRoutedRequest>& Request, bool bHedge)
+{
+	const double Now = FPlatformTime::Seconds();
+	while (Request->CanStartAttempt())
+	{
+		const FGenRouteBackend Backend = Request->Remaining[0];
+		Request->Remaining.RemoveAt(0);
+
+		// The circuit may have opened since the request was ranked
+		FBackendState& State = States.FindOrAdd(MakeKey(Backend));
+		if (!IsAvailable(State, Now))
+		{
+			continue;
+		}
+
+		const int32 AttemptIndex = Request->Attempts.Num();
+		FGenRoutedRequest::FAttempt& Attempt = Request->Attempts.AddDefaulted_GetRef();
+		Attempt.Backend = Backend;
+		Attempt.StartTime = Now;
+		Attempt.bHedge = bHedge;
+		Attempt.bProbe = State.Circuit == ECircuitState::HalfOpen;
+		State.bProbeInFlight |= Attempt.bProbe;
+		State.HedgesStarted += bHedge ? 1 : 0;
+
+		if (bHedge)
+		{
+			UE_LOG(LogGenAIVerbose, Log, TEXT("Router hedging to %s"), *DescribeBackend(Backend));
+		}
+
+		const bool bLastBackend = !Request->CanStartAttempt();
+		FGenRequestHandle Handle = SendToBackend(Backend, Request->Settings, bLastBackend,
+			[Request, AttemptIndex](const FString& Response, const FString& Error, bool bSuccess)
+			{
+				Get().OnAttemptComplete(Request, AttemptIndex, Response, Error, bSuccess);
+			},
+			Request->Settings.bStreamResponse
+				? FGenDeltaCallback([Request, AttemptIndex](const FGenChatStreamDelta& Delta)
+				{
+					Get().OnAttemptDelta(Request, AttemptIndex, Delta);
+				})
+				: FGenDeltaCallback());
+
+		// The attempt may have completed, and started others, before Send returned
+		Request->Attempts[AttemptIndex].Handle = MoveTemp(Handle);
+		if (!bHedge && !Request->bCompleted && !Request->Attempts[AttemptIndex].bDone)
+		{
+			ArmHedge(Request);
+		}
+		return;
+	}
+
+	if (Request->GetNumPending() == 0 && !Request->bCompleted)
+	{
+		Finish(Request, FString(), FString::Printf(TEXT("Every backend failed, last error: %s"), *Request->LastError), false);
+	}
+}
+
+void FGenProviderRouter::ArmHedge(const TSharedRef<FGenRoutedRequest>& Request)
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(Request->HedgeTimer);
+	Request->HedgeTimer.Reset();
+	if (!Request->Settings.bHedge || !Request->CanStartAttempt())
+	{
+		return;
+	}
+
+	const UGenerativeAISupportRuntimeSettings* RuntimeSettings = GetDefault<UGenerativeAISupportRuntimeSettings>();
+	float Delay = Request->Settings.HedgeDelaySeconds;
+	if (Delay <= 0.0f)
+	{
+		const FBackendState& State = States.FindOrAdd(MakeKey(Request->Attempts.Last().Backend));
+		Delay = State.RecentLatencies.Num() >= MinSamplesForP95 ? static_cast<float>(State.GetP95Latency()) : RuntimeSettings->RouterDefaultHedgeDelaySeconds;
+		Delay = FMath::Max(Delay, RuntimeSettings->RouterMinHedgeDelaySeconds);
+	}
+
+	const TWeakPtr<FGenRoutedRequest> WeakRequest = Request;
+	Request->HedgeTimer = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakRequest](float)
+	{
+		if (const TSharedPtr<FGenRoutedRequest> Pinned = WeakRequest.Pin())
+		{
+			Pinned->HedgeTimer.Reset();
+			// Nothing to hedge once an attempt started streaming
+			if (!Pinned->bCompleted && Pinned->Winner == INDEX_NONE)
+			{
+				Get().StartAttempt(Pinned.ToSharedRef(), true);
+			}
+		}
+		return false;
+	}), Delay);
+}
+
+void FGenProviderRouter::OnAttemptDelta(const TSharedRef<FGenRoutedRequest>& Request, int32 AttemptIndex, const FGenChatStreamDelta& Delta)
+{
+	if (Request->bCompleted)
+	{
+		return;
+	}
+	if (Request->Winner == INDEX_NONE)
+	{
+		Request->Winner = AttemptIndex;
+		FTSTicker::GetCoreTicker().RemoveTicker(Request->HedgeTimer);
+		Request->HedgeTimer.Reset();
+		CancelAttempts(*Request, AttemptIndex, true);
+	}
+	if (Request->Winner == AttemptIndex && Request->DeltaCallback)
+	{
+		Request->DeltaCallback(Delta);
+	}
+}
+
+void FGenProviderRouter::OnAttemptComplete(const TSharedRef<FGenRoutedRequest>& Request, int32 AttemptIndex, const FString& Response,
+                                           const FString& Error, bool bSuccess)
+{
+	FGenRoutedRequest::FAttempt& Attempt = Request->Attempts[AttemptIndex];
+	if (Attempt.bDone)
+	{
+		return;
+	}
+	Attempt.bDone = true;
+	RecordResult(Attempt.Backend, FPlatformTime::Seconds() - Attempt.StartTime, bSuccess);
+	if (Attempt.bProbe)
+	{
+		States.FindOrAdd(MakeKey(Attempt.Backend)).bProbeInFlight = false;
+	}
+
+	if (Request->bCompleted)
+	{
+		return;
+	}
+
+	if (bSuccess && (Request->Winner == INDEX_NONE || Request->Winner == AttemptIndex))
+	{
+		if (Attempt.bHedge)
+		{
+			States.FindOrAdd(MakeKey(Attempt.Backend)).HedgesWon++;
+		}
+		Request->Winner = AttemptIndex;
+		CancelAttempts(*Request, AttemptIndex, true);
+		Finish(Request, Response, FString(), true);
+		return;
+	}
+
+	Request->LastError = Error;
+	if (Request->Winner == AttemptIndex)
+	{
+		// Deltas already reached the caller, another backend cannot continue them
+		Finish(Request, FString(), Error, false);
+		return;
+	}
+
+	if (Request->GetNumPending() == 0)
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Router attempt on %s failed: %s"), *DescribeBackend(Attempt.Backend), *Error);
+		StartAttempt(Request, false);
+	}
+}
+
+void FGenProviderRouter::CancelAttempts(FGenRoutedRequest& Request, int32 Winner, bool bRecordLatency)
+{
+	const double Now = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Request.Attempts.Num(); ++Index)
+	{
+		FGenRoutedRequest::FAttempt& Attempt = Request.Attempts[Index];
+		if (Index == Winner || Attempt.bDone)
+		{
+			continue;
+		}
+		Attempt.bDone = true;
+		Attempt.Handle.Cancel();
+
+		FBackendState& State = States.FindOrAdd(MakeKey(Attempt.Backend));
+		State.bProbeInFlight &= !Attempt.bProbe;
+		if (bRecordLatency)
+		{
+			// The loser would have taken at least this long, leaving it out would make slow backends look fast
+			State.AddLatency(Now - Attempt.StartTime);
+		}
+	}
+}
+
+void FGenProviderRouter::Abort(const TWeakPtr<FGenRoutedRequest>& WeakRequest, const FString& Error)
+{
+	const TSharedPtr<FGenRoutedRequest> Request = WeakRequest.Pin();
+	if (!Request.IsValid() || Request->bCompleted)
+	{
+		return;
+	}
+	// Not the backends' fault, so no latency or failure is recorded against them
+	CancelAttempts(*Request, INDEX_NONE, false);
+	Finish(Request.ToSharedRef(), FString(), Error, false);
+}
+
+void FGenProviderRouter::Finish(const TSharedRef<FGenRoutedRequest>& Request, const FString& Response, const FString& Error, bool bSuccess)
+{
+	Request->bCompleted = true;
+	Request->ReleaseTimers();
+
+	const FGenResponseCallback Callback = MoveTemp(Request->ResponseCallback);
+	Request->DeltaCallback = nullptr;
+	if (Callback)
+	{
+		Callback(Response, Error, bSuccess);
+	}
+}
+
+void FGenProviderRouter::RecordResult(const FGenRouteBackend& Backend, double LatencySeconds, bool bSuccess)
+{
+	const UGenerativeAISupportRuntimeSettings* RuntimeSettings = GetDefault<UGenerativeAISupportRuntimeSettings>();
+	FBackendState& State = States.FindOrAdd(MakeKey(Backend));
+	State.Requests++;
+	State.ErrorRate += ErrorAlpha * ((bSuccess ? 0.0 : 1.0) - State.ErrorRate);
+
+	if (bSuccess)
+	{
+		// Failures often return fast, only successful answers say how long an answer takes
+		State.AddLatency(LatencySeconds);
+		State.ConsecutiveFailures = 0;
+		if (State.Circuit != ECircuitState::Closed)
+		{
+			UE_LOG(LogGenAI, Log, TEXT("Router closed the circuit of %s"), *DescribeBackend(Backend));
+			State.Circuit = ECircuitState::Closed;
+		}
+		return;
+	}
+
+	State.Failures++;
+	State.ConsecutiveFailures++;
+	if (State.Circuit == ECircuitState::HalfOpen || (State.Circuit == ECircuitState::Closed && State.ConsecutiveFailures >= RuntimeSettings->RouterCircuitFailureThreshold))
+	{
+		State.Circuit = ECircuitState::Open;
+		State.OpenUntil = FPlatformTime::Seconds() + RuntimeSettings->RouterCircuitCooldownSeconds;
+		UE_LOG(LogGenAI, Warning, TEXT("Router opened the circuit of %s after %d consecutive failures"), *DescribeBackend(Backend),
+		       State.ConsecutiveFailures);
+	}
+}
+
+FGenRequestHandle FGenProviderRouter::SendToBackend(const FGenRouteBackend& Backend, const FGenRoutedChatSettings& Settings, bool bLastBackend,
+                                                    FGenResponseCallback ResponseCallback, FGenDeltaCallback DeltaCallback)
+{
+	FGenRequestOptions Options = Settings.RequestOptions;
+	if (!bLastBackend)
+	{
+		// Failing over to the next backend is faster than backing off and retrying this one
+		Options.MaxRetries = 0;
+	}
+	// Enforced by the router for all attempts together, see FGenProviderRouter::Abort
+	Options.DeadlineSeconds = 0.0f;
+	Options.CancellationToken = FGenCancellationToken();
+
+	switch (Backend.Org)
+	{
+	case EGenAIOrgs::OpenAI:
+		{
+			FGenChatSettings ChatSettings;
+			ChatSettings.ModelEnum = EGenOAIChatModel::Custom;
+			ChatSettings.CustomModel = Backend.Model;
+			ChatSettings.UpdateModel();
+			ChatSettings.MaxTokens = Settings.MaxTokens;
+			ChatSettings.Messages = Settings.Messages;
+			ChatSettings.bStreamResponse = Settings.bStreamResponse;
+			ChatSettings.RequestOptions = Options;
+			return TGenRequestEngine<FGenOpenAIChatTraits>::Send(ChatSettings, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+		}
+	case EGenAIOrgs::Anthropic:
+		{
+			// System messages are hoisted into the system prompt by the traits
+			FGenClaudeChatSettings ChatSettings;
+			ChatSettings.Model = EClaudeModels::Custom;
+			ChatSettings.CustomModel = Backend.Model;
+			ChatSettings.MaxTokens = Settings.MaxTokens;
+			ChatSettings.Messages = Settings.Messages;
+			ChatSettings.bStreamResponse = Settings.bStreamResponse;
+			ChatSettings.RequestOptions = Options;
+			return TGenRequestEngine<FGenClaudeChatTraits>::Send(ChatSettings, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+		}
+	case EGenAIOrgs::DeepSeek:
+		{
+			FGenDSeekChatSettings ChatSettings;
+			if (!TryResolveDeepSeekModel(Backend.Model, ChatSettings.Model))
+			{
+				ResponseCallback(FString(), FString::Printf(TEXT("%s is not a DeepSeek model"), *Backend.Model), false);
+				return FGenRequestHandle();
+			}
+			ChatSettings.MaxTokens = Settings.MaxTokens;
+			ChatSettings.Messages = Settings.Messages;
+			ChatSettings.bStreamResponse = Settings.bStreamResponse;
+			ChatSettings.RequestOptions = Options;
+			return TGenRequestEngine<FGenDeepSeekChatTraits>::Send(ChatSettings, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+		}
+	case EGenAIOrgs::XAI:
+		{
+			FGenXAIChatSettings ChatSettings;
+			ChatSettings.Model = Backend.Model;
+			ChatSettings.MaxTokens = Settings.MaxTokens;
+			ChatSettings.Messages.Reserve(Settings.Messages.Num());
+			for (const FGenChatMessage& Message : Settings.Messages)
+			{
+				FGenXAIMessage& XAIMessage = ChatSettings.Messages.AddDefaulted_GetRef();
+				XAIMessage.Role = Message.Role;
+				XAIMessage.Content = Message.Content;
+			}
+			ChatSettings.bStreamResponse = Settings.bStreamResponse;
+			ChatSettings.RequestOptions = Options;
+			return TGenRequestEngine<FGenXAIChatTraits>::Send(ChatSettings, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+		}
+	default:
+		ResponseCallback(FString(), FString::Printf(TEXT("%s is not supported by the provider router"), *UEnum::GetDisplayValueAsText(Backend.Org).ToString()), false);
+		return FGenRequestHandle();
+	}
+}
+
+TArray<FGenBackendHealth> UGenProviderRouterLibrary::GetBackendHealth()
+{
+	return FGenProviderRouter::Get().GetHealth();
+}
+
+void UGenProviderRouterLibrary::ResetBackendHealth()
+{
+	FGenProviderRouter::Get().ResetHealth();
+}
@@ -0,0 +1,641 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenProviderTraits.h"
+
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenJsonPayloadWriter.h"
+#include "Utilities/GenJsonPullReader.h"
+#include "Utilities/GenSchemaRegistry.h"
+#include "Utilities/GenSSEParser.h"
+#include "Utilities/GenUtils.h"
+
+namespace
+{
+	template <typename TMessage>
+	void WriteMessageElements(FGenJsonPayloadWriter& Writer, const TArray<TMessage>& Messages)
+	{
+		for (const TMessage& Message : Messages)
+		{
+			FGenConversation::WriteMessage(Writer, Message.Role, Message.Content);
+		}
+	}
+
+	template <typename TMessage>
+	void WriteMessages(FGenJsonPayloadWriter& Writer, const TArray<TMessage>& Messages)
+	{
+		Writer.BeginArray(TEXT("messages"));
+		WriteMessageElements(Writer, Messages);
+		Writer.EndArray();
+	}
+
+	// Anthropic rejects requests with more cache breakpoints than this
+	constexpr int32 MaxClaudeCacheBreakpoints = 4;
+
+	void WriteClaudeTextBlock(FGenJsonPayloadWriter& Writer, FStringView Text, bool bCacheBreakpoint, EGenClaudeCacheTTL CacheTTL)
+	{
+		Writer.BeginObject();
+		Writer.WriteString(TEXT("type"), TEXT("text"));
+		Writer.WriteString(TEXT("text"), Text);
+		if (bCacheBreakpoint)
+		{
+			Writer.BeginObject(TEXT("cache_control"));
+			Writer.WriteString(TEXT("type"), TEXT("ephemeral"));
+			if (CacheTTL == EGenClaudeCacheTTL::OneHour)
+			{
+				Writer.WriteString(TEXT("ttl"), TEXT("1h"));
+			}
+			Writer.EndObject();
+		}
+		Writer.EndObject();
+	}
+
+	// error.message, the error shape is the same for every provider
+	bool TryGetErrorMessage(const FGenJsonFieldQuery& Error, const FGenJsonFieldQuery& ErrorMessage, FString& OutErrorMessage)
+	{
+		if (!Error.bFound || Error.ValueType != EGenJsonToken::ObjectStart)
+		{
+			return false;
+		}
+		OutErrorMessage = ErrorMessage.IsString() ? ErrorMessage.Value : TEXT("Unknown error");
+		return true;
+	}
+
+	int64 GetTokenCount(const FGenJsonFieldQuery& Query)
+	{
+		return Query.bFound && Query.ValueType == EGenJsonToken::Number ? FCString::Atoi64(*Query.Value) : 0;
+	}
+
+	// Cached prompt tokens are part of prompt_tokens here, unlike in FGenTokenUsage
+	FGenTokenUsage MakeChatCompletionUsage(const FGenJsonFieldQuery& PromptTokens, const FGenJsonFieldQuery& CompletionTokens,
+	                                       const FGenJsonFieldQuery& CachedTokens, const FGenJsonFieldQuery& CacheHitTokens)
+	{
+		FGenTokenUsage Usage;
+		Usage.CacheReadInputTokens = FMath::Max(GetTokenCount(CachedTokens), GetTokenCount(CacheHitTokens));
+		Usage.InputTokens = FMath::Max<int64>(GetTokenCount(PromptTokens) - Usage.CacheReadInputTokens, 0);
+		Usage.OutputTokens = GetTokenCount(CompletionTokens);
+		return Usage;
+	}
+
+	// "stream": true, asking for the usage chunk that closes the stream, streamed usage is not reported otherwise
+	void WriteStreamFlags(FGenJsonPayloadWriter& Writer)
+	{
+		Writer.WriteBool(TEXT("stream"), true);
+		Writer.BeginObject(TEXT("stream_options"));
+		Writer.WriteBool(TEXT("include_usage"), true);
+		Writer.EndObject();
+	}
+
+	// Refusals stream in pieces like content, when collected they become the error the stream fails with
+	void HandleChatCompletionsEvent(const FGenSSEEvent& Event, FGenStreamState& State, FGenChatStreamDelta& OutDelta, bool bCollectRefusal)
+	{
+		if (Event.IsData("[DONE]"))
+		{
+			State.bDone = true;
+			return;
+		}
+
+		// The usage chunk closing the stream carries no choices, none of the choice queries are found then
+		FGenJsonFieldQuery Error("error");
+		FGenJsonFieldQuery ErrorMessage("error.message");
+		FGenJsonFieldQuery Content("choices.0.delta.content");
+		FGenJsonFieldQuery ReasoningContent("choices.0.delta.reasoning_content");
+		FGenJsonFieldQuery Refusal("choices.0.delta.refusal");
+		FGenJsonFieldQuery FinishReason("choices.0.finish_reason");
+		FGenJsonFieldQuery PromptTokens("usage.prompt_tokens");
+		FGenJsonFieldQuery CompletionTokens("usage.completion_tokens");
+		FGenJsonFieldQuery CachedTokens("usage.prompt_tokens_details.cached_tokens");
+		FGenJsonFieldQuery CacheHitTokens("usage.prompt_cache_hit_tokens");
+		FGenJsonFieldQuery* const Queries[] = {&Error, &ErrorMessage, &Content, &ReasoningContent, &Refusal, &FinishReason,
+		                                       &PromptTokens, &CompletionTokens, &CachedTokens, &CacheHitTokens};
+		if (!GenJson::ExtractFields(Event.Data, Queries))
+		{
+			UE_LOG(LogGenAI, Warning, TEXT("Skipping malformed stream chunk: %s"), *GenJson::ToDebugString(Event.Data));
+			return;
+		}
+
+		if (TryGetErrorMessage(Error, ErrorMessage, State.ErrorMessage))
+		{
+			return;
+		}
+
+		if (PromptTokens.bFound || CompletionTokens.bFound)
+		{
+			State.Usage = MakeChatCompletionUsage(PromptTokens, CompletionTokens, CachedTokens, CacheHitTokens);
+		}
+
+		if (bCollectRefusal && Refusal.IsString())
+		{
+			State.ErrorMessage += Refusal.Value;
+		}
+
+		// Both fields are explicitly null on chunks that only carry the other channel
+		if (Content.IsString())
+		{
+			OutDelta.Content = MoveTemp(Content.Value);
+		}
+		if (ReasoningContent.IsString())
+		{
+			OutDelta.ReasoningContent = MoveTemp(ReasoningContent.Value);
+		}
+		if (FinishReason.IsString())
+		{
+			OutDelta.FinishReason = MoveTemp(FinishReason.Value);
+		}
+
+		State.Content += OutDelta.Content;
+		State.ReasoningContent += OutDelta.ReasoningContent;
+		if (!OutDelta.FinishReason.IsEmpty())
+		{
+			State.FinishReason = OutDelta.FinishReason;
+		}
+	}
+
+	// Everything the chat/completions based providers read from a non-streamed response, picked up in one pass
+	struct FChatCompletionFields
+	{
+		explicit FChatCompletionFields(TConstArrayView<uint8> ResponseJson)
+		{
+			FGenJsonFieldQuery* const Queries[] = {&Content, &Refusal, &ReasoningContent, &Error, &ErrorMessage,
+			                                       &PromptTokens, &CompletionTokens, &CachedTokens, &CacheHitTokens};
+			bValid = GenJson::ExtractFields(ResponseJson, Queries);
+		}
+
+		FGenTokenUsage GetUsage() const
+		{
+			return MakeChatCompletionUsage(PromptTokens, CompletionTokens, CachedTokens, CacheHitTokens);
+		}
+
+		FGenJsonFieldQuery Content{"choices.0.message.content"};
+		FGenJsonFieldQuery Refusal{"choices.0.message.refusal"};
+		FGenJsonFieldQuery ReasoningContent{"choices.0.message.reasoning_content"};
+		FGenJsonFieldQuery Error{"error"};
+		FGenJsonFieldQuery ErrorMessage{"error.message"};
+		FGenJsonFieldQuery PromptTokens{"usage.prompt_tokens"};
+		FGenJsonFieldQuery CompletionTokens{"usage.completion_tokens"};
+		FGenJsonFieldQuery CachedTokens{"usage.prompt_tokens_details.cached_tokens"};
+		// DeepSeek reports its context cache separately
+		FGenJsonFieldQuery CacheHitTokens{"usage.prompt_cache_hit_tokens"};
+		bool bValid = false;
+	};
+
+	FGenParsedResponse ParseChatCompletion(FChatCompletionFields& Fields, TConstArrayView<uint8> ResponseJson)
+	{
+		if (Fields.Content.IsString())
+		{
+			FGenParsedResponse Result = FGenParsedResponse::Success(MoveTemp(Fields.Content.Value));
+			Result.Usage = Fields.GetUsage();
+			return Result;
+		}
+
+		FString ErrorMessage;
+		if (TryGetErrorMessage(Fields.Error, Fields.ErrorMessage, ErrorMessage))
+		{
+			return FGenParsedResponse::Failure(MoveTemp(ErrorMessage));
+		}
+
+		if (!Fields.bValid)
+		{
+			return FGenParsedResponse::Failure(FString::Printf(TEXT("Failed to parse response: %s"), *GenJson::ToDebugString(ResponseJson)));
+		}
+		return FGenParsedResponse::Failure(FString::Printf(TEXT("Unexpected JSON structure: %s"), *GenJson::ToDebugString(ResponseJson)));
+	}
+}
+
+// --- OpenAI compatible chat/completions ----------------------------------------------------------
+
+void FGenChatCompletionsTraits::SetAuthHeaders(IHttpRequest& HttpRequest, const FString& ApiKey)
+{
+	HttpRequest.SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *ApiKey));
+}
+
+FGenParsedResponse FGenChatCompletionsTraits::ParseResponse(TConstArrayView<uint8> ResponseJson)
+{
+	FChatCompletionFields Fields(ResponseJson);
+	return ParseChatCompletion(Fields, ResponseJson);
+}
+
+void FGenChatCompletionsTraits::HandleStreamEvent(const FGenSSEEvent& Event, FGenStreamState& State, FGenChatStreamDelta& OutDelta)
+{
+	HandleChatCompletionsEvent(Event, State, OutDelta, false);
+}
+
+// --- OpenAI chat ---------------------------------------------------------------------------------
+
+FString FGenOpenAIChatTraits::GetEndpoint(const FSettings& Settings)
+{
+	return GetDefault<UGenerativeAISupportRuntimeSettings>()->GetBaseUrl(Org) + TEXT("/v1/chat/completions");
+}
+
+FString FGenOpenAIChatTraits::GetModel(const FSettings& Settings)
+{
+	return Settings.GetResolvedModel();
+}
+
+bool FGenOpenAIChatTraits::BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError)
+{
+	FGenJsonPayloadWriter Writer(OutPayload);
+	Writer.BeginObject();
+	Writer.WriteString(TEXT("model"), Settings.GetResolvedModel());
+	Writer.WriteNumber(TEXT("max_completion_tokens"), Settings.MaxTokens);
+	Writer.WriteNumber(TEXT("temperature"), Settings.Temperature);
+	Writer.WriteNumber(TEXT("top_p"), Settings.TopP);
+	if (!Settings.Stop.IsEmpty())
+	{
+		Writer.WriteString(TEXT("stop"), Settings.Stop);
+	}
+	if (Settings.bStreamResponse)
+	{
+		WriteStreamFlags(Writer);
+	}
+
+	if (Settings.ReasoningEffort != EGenAIOpenAIReasoningEffort::Default)
+	{
+		const FString ReasoningEffortString = StaticEnum<EGenAIOpenAIReasoningEffort>()->GetNameStringByValue(static_cast<int64>(Settings.ReasoningEffort));
+		Writer.WriteString(TEXT("reasoning_effort"), ReasoningEffortString.ToLower());
+	}
+
+	if (Settings.Verbosity != EGenAIOpenAIVerbosity::Default)
+	{
+		const FString VerbosityString = StaticEnum<EGenAIOpenAIVerbosity>()->GetNameStringByValue(static_cast<int64>(Settings.Verbosity));
+		Writer.WriteString(TEXT("verbosity"), VerbosityString.ToLower());
+	}
+
+	Writer.BeginArray(TEXT("messages"));
+	Settings.History.WriteMessages(Writer);
+	WriteMessageElements(Writer, Settings.Messages);
+	Writer.EndArray();
+	Writer.EndObject();
+	return true;
+}
+
+// --- OpenAI structured outputs -------------------------------------------------------------------
+
+FString FGenOpenAIStructuredTraits::GetEndpoint(const FSettings& Settings)
+{
+	return GetDefault<UGenerativeAISupportRuntimeSettings>()->GetBaseUrl(Org) + TEXT("/v1/chat/completions");
+}
+
+FString FGenOpenAIStructuredTraits::GetModel(const FSettings& Settings)
+{
+	return Settings.ChatSettings.GetResolvedModel();
+}
+
+bool FGenOpenAIStructuredTraits::BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError)
+{
+	const FGenChatSettings& ChatSettings = Settings.ChatSettings;
+
+	// Parsed and validated once, every later request splices in the cached condensed text
+	TSharedPtr<const FGenCompiledSchema> Schema;
+	if (Settings.bUseSchema)
+	{
+		Schema = FGenSchemaRegistry::Get().Resolve(Settings.SchemaStruct, Settings.SchemaName, Settings.SchemaJson, OutError);
+		if (!Schema.IsValid())
+		{
+			return false;
+		}
+	}
+
+	FGenJsonPayloadWriter Writer(OutPayload);
+	Writer.BeginObject();
+	Writer.WriteString(TEXT("model"), ChatSettings.GetResolvedModel());
+
+	Writer.BeginObject(TEXT("response_format"));
+	if (Settings.bUseSchema)
+	{
+		Writer.WriteString(TEXT("type"), TEXT("json_schema"));
+		Writer.BeginObject(TEXT("json_schema"));
+		Writer.WriteString(TEXT("name"), !Settings.Name.IsEmpty() || Schema->Name.IsNone() ? Settings.Name : Schema->Name.ToString());
+		if (Schema->bStrict)
+		{
+			Writer.WriteBool(TEXT("strict"), true);
+		}
+		Writer.WriteRawJson(TEXT("schema"), Schema->Utf8Json);
+		Writer.EndObject();
+	}
+	else
+	{
+		Writer.WriteString(TEXT("type"), TEXT("json_object"));
+	}
+	Writer.EndObject();
+	Writer.WriteNumber(TEXT("max_completion_tokens"), ChatSettings.MaxTokens);
+	if (ChatSettings.bStreamResponse)
+	{
+		WriteStreamFlags(Writer);
+	}
+
+	Writer.BeginArray(TEXT("messages"));
+	ChatSettings.History.WriteMessages(Writer);
+	for (const FGenChatMessage& Message : ChatSettings.Messages)
+	{
+		Writer.BeginObject();
+		Writer.WriteString(TEXT("role"), Message.Role);
+		if (Message.Role == TEXT("system"))
+		{
+			// in api documentation, it is mentioned that the system message should be appended with "Generate Response in JSON only."
+			Writer.WriteString(TEXT("content"), Message.Content + TEXT(" Generate Response in JSON only. Use proper JSON formatting and avoid introducing line breaks inside string values."));
+		}
+		else
+		{
+			Writer.WriteString(TEXT("content"), Message.Content);
+		}
+		Writer.EndObject();
+	}
+	Writer.EndArray();
+
+	Writer.EndObject();
+	return true;
+}
+
+FGenParsedResponse FGenOpenAIStructuredTraits::ParseResponse(TConstArrayView<uint8> ResponseJson)
+{
+	FChatCompletionFields Fields(ResponseJson);
+	if (Fields.Refusal.IsString())
+	{
+		return FGenParsedResponse::Failure(MoveTemp(Fields.Refusal.Value));
+	}
+	return ParseChatCompletion(Fields, ResponseJson);
+}
+
+void FGenOpenAIStructuredTraits::HandleStreamEvent(const FGenSSEEvent& Event, FGenStreamState& State, FGenChatStreamDelta& OutDelta)
+{
+	HandleChatCompletionsEvent(Event, State, OutDelta, true);
+}
+
+// --- XAI -----------------------------------------------------------------------------------------
+
+FString FGenXAIChatTraits::GetEndpoint(const FSettings& Settings)
+{
+	return GetDefault<UGenerativeAISupportRuntimeSettings>()->GetBaseUrl(Org) + TEXT("/v1/chat/completions");
+}
+
+FString FGenXAIChatTraits::GetModel(const FSettings& Settings)
+{
+	return Settings.Model;
+}
+
+bool FGenXAIChatTraits::BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError)
+{
+	FGenJsonPayloadWriter Writer(OutPayload);
+	Writer.BeginObject();
+	Writer.WriteString(TEXT("model"), Settings.Model);
+	Writer.WriteNumber(TEXT("max_tokens"), Settings.MaxTokens);
+	if (Settings.bStreamResponse)
+	{
+		WriteStreamFlags(Writer);
+	}
+
+	WriteMessages(Writer, Settings.Messages);
+	Writer.EndObject();
+	return true;
+}
+
+// --- DeepSeek ------------------------------------------------------------------------------------
+
+FString FGenDeepSeekChatTraits::GetEndpoint(const FSettings& Settings)
+{
+	return GetDefault<UGenerativeAISupportRuntimeSettings>()->GetBaseUrl(Org) + TEXT("/chat/completions");
+}
+
+FString FGenDeepSeekChatTraits::GetModel(const FSettings& Settings)
+{
+	return UGenUtils::GetEnumDisplayName(StaticEnum<EDeepSeekModels>(), static_cast<int32>(Settings.Model));
+}
+
+bool FGenDeepSeekChatTraits::BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError)
+{
+	FGenJsonPayloadWriter Writer(OutPayload);
+	Writer.BeginObject();
+	Writer.WriteString(TEXT("model"), GetModel(Settings));
+	Writer.WriteNumber(TEXT("max_tokens"), Settings.MaxTokens);
+	if (Settings.bStreamResponse)
+	{
+		WriteStreamFlags(Writer);
+	}
+	else
+	{
+		Writer.WriteBool(TEXT("stream"), false);
+	}
+
+	WriteMessages(Writer, Settings.Messages);
+	Writer.EndObject();
+	return true;
+}
+
+FGenParsedResponse FGenDeepSeekChatTraits::ParseResponse(TConstArrayView<uint8> ResponseJson)
+{
+	FChatCompletionFields Fields(ResponseJson);
+	FGenParsedResponse Result = ParseChatCompletion(Fields, ResponseJson);
+	// If using deepseek-reasoner, extract reasoning content as well
+	if (Result.bSuccess && Fields.ReasoningContent.IsString())
+	{
+		Result.Content += TEXT("\n\nReasoning:\n") + Fields.ReasoningContent.Value;
+	}
+	return Result;
+}
+
+// --- Anthropic -----------------------------------------------------------------------------------
+
+FString FGenClaudeChatTraits::GetEndpoint(const FSettings& Settings)
+{
+	return GetDefault<UGenerativeAISupportRuntimeSettings>()->GetBaseUrl(Org) + TEXT("/v1/messages");
+}
+
+FString FGenClaudeChatTraits::GetModel(const FSettings& Settings)
+{
+	return Settings.Model == EClaudeModels::Custom
+		? Settings.CustomModel
+		: UGenUtils::GetEnumDisplayName(StaticEnum<EClaudeModels>(), static_cast<int32>(Settings.Model));
+}
+
+void FGenClaudeChatTraits::SetAuthHeaders(IHttpRequest& HttpRequest, const FString& ApiKey)
+{
+	HttpRequest.SetHeader(TEXT("x-api-key"), ApiKey);
+	HttpRequest.SetHeader(TEXT("anthropic-version"), TEXT("2023-06-01"));
+}
+
+bool FGenClaudeChatTraits::BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError)
+{
+	const FString ModelName = GetModel(Settings);
+
+	// Empty text blocks are rejected, they are skipped and "system" is left out when nothing remains
+	bool bHasSystemPrompt = false;
+	int32 LastMessageIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Settings.Messages.Num(); ++Index)
+	{
+		if (Settings.Messages[Index].Role == TEXT("system"))
+		{
+			bHasSystemPrompt |= !Settings.Messages[Index].Content.IsEmpty();
+		}
+		else
+		{
+			LastMessageIndex = Index;
+		}
+	}
+
+	const bool bCacheLastMessage = Settings.bCacheMessageHistory && LastMessageIndex != INDEX_NONE;
+	int32 NumBreakpoints = bCacheLastMessage ? 1 : 0;
+	for (const FGenClaudeSystemBlock& Block : Settings.SystemBlocks)
+	{
+		bHasSystemPrompt |= !Block.Text.IsEmpty();
+		NumBreakpoints += Block.bCacheBreakpoint && !Block.Text.IsEmpty() ? 1 : 0;
+	}
+	if (NumBreakpoints > MaxClaudeCacheBreakpoints)
+	{
+		OutError = FString::Printf(TEXT("Claude accepts at most %d cache breakpoints per request, got %d"), MaxClaudeCacheBreakpoints, NumBreakpoints);
+		return false;
+	}
+
+	FGenJsonPayloadWriter Writer(OutPayload);
+	Writer.BeginObject();
+	Writer.WriteString(TEXT("model"), ModelName);
+	Writer.WriteNumber(TEXT("max_tokens"), Settings.MaxTokens);
+	Writer.WriteNumber(TEXT("temperature"), Settings.Temperature);
+	Writer.WriteBool(TEXT("stream"), Settings.bStreamResponse);
+
+	if (bHasSystemPrompt)
+	{
+		Writer.BeginArray(TEXT("system"));
+		for (const FGenClaudeSystemBlock& Block : Settings.SystemBlocks)
+		{
+			if (!Block.Text.IsEmpty())
+			{
+				WriteClaudeTextBlock(Writer, Block.Text, Block.bCacheBreakpoint, Settings.CacheTTL);
+			}
+		}
+		for (const FGenChatMessage& Message : Settings.Messages)
+		{
+			if (Message.Role == TEXT("system") && !Message.Content.IsEmpty())
+			{
+				WriteClaudeTextBlock(Writer, Message.Content, false, Settings.CacheTTL);
+			}
+		}
+		Writer.EndArray();
+	}
+
+	Writer.BeginArray(TEXT("messages"));
+	for (int32 Index = 0; Index < Settings.Messages.Num(); ++Index)
+	{
+		const FGenChatMessage& Message = Settings.Messages[Index];
+		if (Message.Role == TEXT("system"))
+		{
+			continue;
+		}
+
+		Writer.BeginObject();
+		Writer.WriteString(TEXT("role"), Message.Role);
+		if (bCacheLastMessage && Index == LastMessageIndex)
+		{
+			// A breakpoint needs the block form of content
+			Writer.BeginArray(TEXT("content"));
+			WriteClaudeTextBlock(Writer, Message.Content, true, Settings.CacheTTL);
+			Writer.EndArray();
+		}
+		else
+		{
+			Writer.WriteString(TEXT("content"), Message.Content);
+		}
+		Writer.EndObject();
+	}
+	Writer.EndArray();
+	Writer.EndObject();
+	return true;
+}
+
+FGenParsedResponse FGenClaudeChatTraits::ParseResponse(TConstArrayView<uint8> ResponseJson)
+{
+	// Skip thinking / tool blocks, the answer is the first text block
+	FGenJsonFieldQuery Text("content.*.text");
+	FGenJsonFieldQuery Error("error");
+	FGenJsonFieldQuery ErrorMessage("error.message");
+	FGenJsonFieldQuery InputTokens("usage.input_tokens");
+	FGenJsonFieldQuery OutputTokens("usage.output_tokens");
+	FGenJsonFieldQuery CacheCreationTokens("usage.cache_creation_input_tokens");
+	FGenJsonFieldQuery CacheReadTokens("usage.cache_read_input_tokens");
+	FGenJsonFieldQuery* const Queries[] = {&Text, &Error, &ErrorMessage, &InputTokens, &OutputTokens, &CacheCreationTokens, &CacheReadTokens};
+	const bool bValid = GenJson::ExtractFields(ResponseJson, Queries);
+
+	if (Text.IsString())
+	{
+		FGenParsedResponse Result = FGenParsedResponse::Success(MoveTemp(Text.Value));
+		Result.Usage.InputTokens = GetTokenCount(InputTokens);
+		Result.Usage.OutputTokens = GetTokenCount(OutputTokens);
+		Result.Usage.CacheCreationInputTokens = GetTokenCount(CacheCreationTokens);
+		Result.Usage.CacheReadInputTokens = GetTokenCount(CacheReadTokens);
+		return Result;
+	}
+
+	FString ErrorString;
+	if (TryGetErrorMessage(Error, ErrorMessage, ErrorString))
+	{
+		return FGenParsedResponse::Failure(MoveTemp(ErrorString));
+	}
+
+	if (!bValid)
+	{
+		UE_LOG(LogGenAIVerbose, Log, TEXT("Unparsable Claude response: %s"), *GenJson::ToDebugString(ResponseJson));
+	}
+	return FGenParsedResponse::Failure(TEXT("Invalid response format from Claude API"));
+}
+
+void FGenClaudeChatTraits::HandleStreamEvent(const FGenSSEEvent& Event, FGenStreamState& State, FGenChatStreamDelta& OutDelta)
+{
+	FGenJsonFieldQuery Type("type");
+	FGenJsonFieldQuery Text("delta.text");
+	FGenJsonFieldQuery StopReason("delta.stop_reason");
+	FGenJsonFieldQuery Error("error");
+	FGenJsonFieldQuery ErrorMessage("error.message");
+	// Prompt usage arrives with message_start, the running output count with message_delta
+	FGenJsonFieldQuery InputTokens("message.usage.input_tokens");
+	FGenJsonFieldQuery CacheCreationTokens("message.usage.cache_creation_input_tokens");
+	FGenJsonFieldQuery CacheReadTokens("message.usage.cache_read_input_tokens");
+	FGenJsonFieldQuery OutputTokens("usage.output_tokens");
+	FGenJsonFieldQuery* const Queries[] = {&Type, &Text, &StopReason, &Error, &ErrorMessage,
+	                                       &InputTokens, &CacheCreationTokens, &CacheReadTokens, &OutputTokens};
+	if (!GenJson::ExtractFields(Event.Data, Queries))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Claude stream: skipping malformed event data: %s"), *GenJson::ToDebugString(Event.Data));
+		return;
+	}
+
+	const FString& EventType = Event.Event.IsEmpty() ? Type.Value : Event.Event;
+
+	// Only text deltas, usage, the stop reason and errors are of interest, ping and content block start / stop events are ignored
+	if (EventType == TEXT("content_block_delta"))
+	{
+		if (Text.IsString())
+		{
+			OutDelta.Content = MoveTemp(Text.Value);
+			State.Content += OutDelta.Content;
+		}
+	}
+	else if (EventType == TEXT("message_start"))
+	{
+		State.Usage.InputTokens = GetTokenCount(InputTokens);
+		State.Usage.CacheCreationInputTokens = GetTokenCount(CacheCreationTokens);
+		State.Usage.CacheReadInputTokens = GetTokenCount(CacheReadTokens);
+	}
+	else if (EventType == TEXT("message_delta"))
+	{
+		if (OutputTokens.bFound)
+		{
+			State.Usage.OutputTokens = GetTokenCount(OutputTokens);
+		}
+		if (StopReason.IsString())
+		{
+			OutDelta.FinishReason = MoveTemp(StopReason.Value);
+			State.FinishReason = OutDelta.FinishReason;
+		}
+	}
+	else if (EventType == TEXT("message_stop"))
+	{
+		State.bDone = true;
+	}
+	else if (EventType == TEXT("error"))
+	{
+		TryGetErrorMessage(Error, ErrorMessage, State.ErrorMessage);
+	}
+}
@@ -0,0 +1,252 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenRateLimiter.h"
+
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "Utilities/GenGlobalDefinitions.h"
+
+namespace
+{
+	// Retries that may be spent back to back after a quiet period
+	constexpr double MaxRetryBudget = 10.0;
+
+	/**
+	 * Reset values come either as a Go style duration ("1s", "6m0s", "20ms", OpenAI and XAI)
+	 * or as an RFC 3339 timestamp (Anthropic)
+	 */
+	bool ParseResetSeconds(const FString& Value, double& OutSeconds)
+	{
+		FDateTime ResetTime;
+		if (FDateTime::ParseIso8601(*Value, ResetTime))
+		{
+			OutSeconds = FMath::Max(0.0, (ResetTime - FDateTime::UtcNow()).GetTotalSeconds());
+			return true;
+		}
+
+		double Seconds = 0.0;
+		int32 Index = 0;
+		while (Index < Value.Len())
+		{
+			const int32 NumberStart = Index;
+			while (Index < Value.Len() && (FChar::IsDigit(Value[Index]) || Value[Index] == TEXT('.')))
+			{
+				++Index;
+			}
+			if (Index == NumberStart)
+			{
+				return false;
+			}
+			const double Number = FCString::Atod(*Value.Mid(NumberStart, Index - NumberStart));
+
+			if (Value.Mid(Index, 2) == TEXT("ms"))
+			{
+				Seconds += Number / 1000.0;
+				Index += 2;
+			}
+			else if (Index < Value.Len() && Value[Index] == TEXT('h'))
+			{
+				Seconds += Number * 3600.0;
+				++Index;
+			}
+			else if (Index < Value.Len() && Value[Index] == TEXT('m'))
+			{
+				Seconds += Number * 60.0;
+				++Index;
+			}
+			else
+			{
+				// "s" or a bare number of seconds
+				Seconds += Number;
+				Index += Index < Value.Len() && Value[Index] == TEXT('s') ? 1 : 0;
+			}
+		}
+		OutSeconds = Seconds;
+		return true;
+	}
+
+	// Reads one limit/remaining/reset triple, trying the OpenAI and the Anthropic header names
+	bool ReadLimitHeaders(const FHttpResponsePtr& Response, const TCHAR* Resource, double& OutLimit, double& OutRemaining, double& OutResetSeconds)
+	{
+		FString Limit = Response->GetHeader(FString::Printf(TEXT("x-ratelimit-limit-%s"), Resource));
+		FString Remaining = Response->GetHeader(FString::Printf(TEXT("x-ratelimit-remaining-%s"), Resource));
+		FString Reset = Response->GetHeader(FString::Printf(TEXT("x-ratelimit-reset-%s"), Resource));
+		if (Limit.IsEmpty())
+		{
+			Limit = Response->GetHeader(FString::Printf(TEXT("anthropic-ratelimit-%s-limit"), Resource));
+			Remaining = Response->GetHeader(FString::Printf(TEXT("anthropic-ratelimit-%s-remaining"), Resource));
+			Reset = Response->GetHeader(FString::Printf(TEXT("anthropic-ratelimit-%s-reset"), Resource));
+		}
+
+		if (Limit.IsEmpty() || Remaining.IsEmpty())
+		{
+			return false;
+		}
+
+		OutLimit = FCString::Atod(*Limit);
+		OutRemaining = FCString::Atod(*Remaining);
+		OutResetSeconds = 0.0;
+		if (!Reset.IsEmpty())
+		{
+			ParseResetSeconds(Reset, OutResetSeconds);
+		}
+		return OutLimit > 0.0;
+	}
+}
+
+void FGenRateLimiter::FBucket::Refill(double Now)
+{
+	if (Capacity >= 0.0)
+	{
+		Available = FMath::Min(Capacity, Available + (Now - LastRefillTime) * RefillPerSecond);
+	}
+	LastRefillTime = Now;
+}
+
+void FGenRateLimiter::FBucket::Apply(double Limit, double Remaining, double ResetSeconds, double Now)
+{
+	Capacity = Limit;
+	Available = FMath::Clamp(Remaining, 0.0, Limit);
+	// The provider reports when the bucket will be full again, assume it refills linearly until then
+	RefillPerSecond = ResetSeconds > 0.0 ? FMath::Max((Limit - Remaining) / ResetSeconds, Limit / 60.0) : Limit;
+	LastRefillTime = Now;
+}
+
+double FGenRateLimiter::FBucket::GetDelay(double Cost) const
+{
+	if (Capacity < 0.0)
+	{
+		return 0.0;
+	}
+
+	// A request larger than the whole bucket would never fit, let it through once the bucket is full
+	const double Needed = FMath::Min(Cost, Capacity) - Available;
+	if (Needed <= 0.0)
+	{
+		return 0.0;
+	}
+	return RefillPerSecond > 0.0 ? Needed / RefillPerSecond : 1.0;
+}
+
+FGenRateLimiter& FGenRateLimiter::Get()
+{
+	static FGenRateLimiter Instance;
+	return Instance;
+}
+
+double FGenRateLimiter::TryAcquire(EGenAIOrgs Org, uint32 KeyHash, int32 EstimatedTokens)
+{
+	FKeyState* State = States.Find(TPair<EGenAIOrgs, uint32>(Org, KeyHash));
+	if (!State)
+	{
+		return 0.0;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (State->BlockedUntil > Now)
+	{
+		return State->BlockedUntil - Now;
+	}
+
+	State->Requests.Refill(Now);
+	State->Tokens.Refill(Now);
+	const double Delay = FMath::Max(State->Requests.GetDelay(1.0), State->Tokens.GetDelay(EstimatedTokens));
+	if (Delay > 0.0)
+	{
+		return Delay;
+	}
+
+	State->Requests.Available -= State->Requests.Capacity >= 0.0 ? 1.0 : 0.0;
+	State->Tokens.Available -= State->Tokens.Capacity >= 0.0 ? FMath::Min<double>(EstimatedTokens, State->Tokens.Available) : 0.0;
+	return 0.0;
+}
+
+void FGenRateLimiter::UpdateFromResponse(EGenAIOrgs Org, uint32 KeyHash, const FHttpResponsePtr& Response)
+{
+	if (!Response.IsValid())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	double Limit = 0.0;
+	double Remaining = 0.0;
+	double ResetSeconds = 0.0;
+	FKeyState* State = nullptr;
+
+	if (ReadLimitHeaders(Response, TEXT("requests"), Limit, Remaining, ResetSeconds))
+	{
+		State = &States.FindOrAdd(TPair<EGenAIOrgs, uint32>(Org, KeyHash));
+		State->Requests.Apply(Limit, Remaining, ResetSeconds, Now);
+	}
+	if (ReadLimitHeaders(Response, TEXT("tokens"), Limit, Remaining, ResetSeconds))
+	{
+		State = &States.FindOrAdd(TPair<EGenAIOrgs, uint32>(Org, KeyHash));
+		State->Tokens.Apply(Limit, Remaining, ResetSeconds, Now);
+	}
+
+	const double RetryAfter = GetRetryAfterSeconds(Response);
+	if (RetryAfter > 0.0 || Response->GetResponseCode() == EHttpResponseCodes::TooManyRequests)
+	{
+		State = &States.FindOrAdd(TPair<EGenAIOrgs, uint32>(Org, KeyHash));
+		State->BlockedUntil = FMath::Max(State->BlockedUntil, Now + FMath::Max(RetryAfter, 1.0));
+		UE_LOG(LogGenAI, Warning, TEXT("Rate limited by %s, holding requests for %.1f s"),
+		       *UEnum::GetDisplayValueAsText(Org).ToString(), State->BlockedUntil - Now);
+	}
+}
+
+double FGenRateLimiter::GetRetryAfterSeconds(const FHttpResponsePtr& Response)
+{
+	if (!Response.IsValid())
+	{
+		return -1.0;
+	}
+
+	// retry-after-ms is OpenAI's more precise variant
+	const FString RetryAfterMs = Response->GetHeader(TEXT("retry-after-ms"));
+	if (!RetryAfterMs.IsEmpty() && FCString::IsNumeric(*RetryAfterMs))
+	{
+		return FCString::Atod(*RetryAfterMs) / 1000.0;
+	}
+
+	const FString RetryAfter = Response->GetHeader(TEXT("retry-after"));
+	if (RetryAfter.IsEmpty())
+	{
+		return -1.0;
+	}
+	if (FCString::IsNumeric(*RetryAfter))
+	{
+		return FCString::Atod(*RetryAfter);
+	}
+
+	FDateTime RetryTime;
+	if (FDateTime::ParseHttpDate(RetryAfter, RetryTime))
+	{
+		return FMath::Max(0.0, (RetryTime - FDateTime::UtcNow()).GetTotalSeconds());
+	}
+	return -1.0;
+}
+
+void FGenRateLimiter::DepositRetryBudget()
+{
+	if (RetryBudget < 0.0)
+	{
+		RetryBudget = MaxRetryBudget;
+	}
+	RetryBudget = FMath::Min(MaxRetryBudget, RetryBudget + GetDefault<UGenerativeAISupportRuntimeSettings>()->RetryBudgetRatio);
+}
+
+bool FGenRateLimiter::TryWithdrawRetryBudget()
+{
+	if (RetryBudget < 0.0)
+	{
+		RetryBudget = MaxRetryBudget;
+	}
+	if (RetryBudget < 1.0)
+	{
+		return false;
+	}
+	RetryBudget -= 1.0;
+	return true;
+}
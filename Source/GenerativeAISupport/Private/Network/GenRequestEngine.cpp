@@ -0,0 +1,908 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenRequestEngine.h"
+
+#include "Containers/Ticker.h"
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "HttpModule.h"
+#include "Misc/ScopeLock.h"
+#include "Network/GenRequestMetrics.h"
+#include "Network/GenRequestScheduler.h"
+#include "Network/GenResponseCache.h"
+#include "Network/GenUsageTracker.h"
+#include "Utilities/GenGlobalDefinitions.h"
+
+namespace
+{
+	// Requests that identical requests can still attach to, keyed by FGenRequestContext::CoalesceKey. Game thread only.
+	TMap<FString, TWeakPtr<FGenRequestContext>>& GetInFlightRequests()
+	{
+		static TMap<FString, TWeakPtr<FGenRequestContext>> InFlightRequests;
+		return InFlightRequests;
+	}
+
+	bool IsRetryableResponseCode(int32 ResponseCode)
+	{
+		switch (ResponseCode)
+		{
+		case EHttpResponseCodes::TooManyRequests:
+		case EHttpResponseCodes::ServerError:
+		case EHttpResponseCodes::BadGateway:
+		case EHttpResponseCodes::ServiceUnavail:
+		case EHttpResponseCodes::GatewayTimeout:
+		case 529: // Anthropic: overloaded
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// Body of a complete response, inflated if the HTTP backend handed it over still compressed
+	TConstArrayView<uint8> GetDecodedContent(const TArray<uint8>& Content, TArray<uint8>& Storage)
+	{
+		if (FGenCompression::IsGzip(Content) && FGenCompression::Inflate(Content, Storage))
+		{
+			FGenCompression::RecordResponse(Content.Num(), Storage.Num());
+			return Storage;
+		}
+		FGenCompression::RecordResponse(Content.Num(), Content.Num());
+		return Content;
+	}
+
+	float ToMilliseconds(double From, double To)
+	{
+		return From > 0.0 && To >= From ? static_cast<float>((To - From) * 1000.0) : -1.0f;
+	}
+
+	void RecordMetrics(const FGenRequestContext& Context, const FGenParsedResponse& Result)
+	{
+		const FGenRequestTimings& Timings = Context.Timings;
+		const double Now = FPlatformTime::Seconds();
+		const FGenTokenUsage& Usage = Context.bStream ? Context.StreamState.Usage : Result.Usage;
+
+		FGenRequestSample Sample;
+		Sample.Timestamp = FDateTime::UtcNow();
+		Sample.bSuccess = Result.bSuccess;
+		Sample.bStream = Context.bStream;
+		Sample.Attempts = Context.Attempt + 1;
+		Sample.QueueMs = static_cast<float>(Timings.QueueSeconds * 1000.0);
+		Sample.TimeToFirstByteMs = ToMilliseconds(Timings.SendTime, Timings.FirstByteTime);
+		Sample.TimeToFirstTokenMs = ToMilliseconds(Timings.SendTime, Timings.FirstTokenTime);
+		Sample.TotalMs = ToMilliseconds(Timings.SubmitTime, Now);
+		Sample.RequestBytes = static_cast<float>(Timings.RequestBytes);
+		Sample.ResponseBytes = static_cast<float>(Timings.ResponseWireBytes);
+		Sample.ParseMs = static_cast<float>(Timings.ParseSeconds * 1000.0);
+		// Streams only report usage in their last chunk, and some providers not at all, without it throughput stays unknown
+		// instead of being sampled as 0 tokens/s
+		if (Usage.OutputTokens > 0)
+		{
+			// Streamed output is timed from the first token, so prompt processing does not count against the generation rate
+			const double GenerationStart = Timings.FirstTokenTime > 0.0 ? Timings.FirstTokenTime : Timings.SendTime;
+			Sample.OutputTokens = Usage.OutputTokens;
+			Sample.TokensPerSecond = Now > GenerationStart ? static_cast<float>(Usage.OutputTokens / (Now - GenerationStart)) : -1.0f;
+		}
+		FGenRequestMetrics::Record(Context.Policy.ProviderName, Context.Model, Sample);
+	}
+
+	void RecordToCassette(const FGenRequestContext& Context, bool bReceived, int32 ResponseCode, const TArray<uint8>& Content)
+	{
+		const double Now = FPlatformTime::Seconds();
+		FGenCassetteEntry Entry;
+		Entry.Key = Context.CassetteKey;
+		Entry.Provider = Context.Policy.ProviderName;
+		Entry.Model = Context.Model;
+		Entry.bReceived = bReceived;
+		Entry.ResponseCode = ResponseCode;
+		Entry.bStream = Context.bStream;
+		Entry.FirstByteSeconds = Context.Timings.FirstByteTime > 0.0 ? static_cast<float>(Context.Timings.FirstByteTime - Context.Timings.SendTime) : 0.0f;
+		Entry.TotalSeconds = static_cast<float>(Now - Context.Timings.SendTime);
+		Entry.Body = Content;
+		Entry.Chunks = Context.CassetteChunks;
+		FGenCassette::Get().Record(MoveTemp(Entry));
+	}
+
+	// Disarms the caller's deadline and token, once it got its result or left
+	void ReleaseSubscriber(FGenRequestSubscriber& Subscriber)
+	{
+		if (Subscriber.DeadlineTimer.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(Subscriber.DeadlineTimer);
+			Subscriber.DeadlineTimer.Reset();
+		}
+		Subscriber.CancellationToken.RemoveOnCancelled(Subscriber.CancellationBinding);
+		Subscriber.CancellationBinding.Reset();
+	}
+
+	void RemoveInFlight(const FGenRequestContext& Context)
+	{
+		if (Context.bCoalesce)
+		{
+			TMap<FString, TWeakPtr<FGenRequestContext>>& InFlightRequests = GetInFlightRequests();
+			const TWeakPtr<FGenRequestContext>* Registered = InFlightRequests.Find(Context.CoalesceKey);
+			if (Registered && Registered->Pin().Get() == &Context)
+			{
+				InFlightRequests.Remove(Context.CoalesceKey);
+			}
+		}
+	}
+}
+
+void FGenResponseBodySink::Serialize(void* Data, int64 Length)
+{
+	FScopeLock Lock(&CriticalSection);
+	Received.Append(static_cast<const uint8*>(Data), Length);
+	TotalBytes += Length;
+	if (bRecordChunks)
+	{
+		Writes.Emplace(FPlatformTime::Seconds(), TotalBytes);
+	}
+}
+
+bool FGenResponseBodySink::Drain(TArray<uint8>& Body)
+{
+	FScopeLock Lock(&CriticalSection);
+	if (Received.Num() == 0)
+	{
+		return false;
+	}
+	Body.Append(Received);
+	Received.Reset();
+	return true;
+}
+
+void FGenResponseBodySink::GetChunks(double SendTime, TArray<FGenCassetteChunk>& OutChunks)
+{
+	FScopeLock Lock(&CriticalSection);
+	OutChunks.Reset(Writes.Num());
+	for (const TPair<double, int64>& Write : Writes)
+	{
+		OutChunks.Add({static_cast<float>(Write.Key - SendTime), static_cast<int32>(Write.Value)});
+	}
+}
+
+void FGenRequestHandle::Cancel()
+{
+	if (const TSharedPtr<FGenRequestContext> Pinned = Context.Pin())
+	{
+		FGenRequestEngineBase::Unsubscribe(Pinned.ToSharedRef(), SubscriberId);
+	}
+	Context.Reset();
+}
+
+bool FGenRequestHandle::IsPending() const
+{
+	const TSharedPtr<FGenRequestContext> Pinned = Context.Pin();
+	return Pinned.IsValid() && !Pinned->bCompleted
+		&& Pinned->Subscribers.ContainsByPredicate([this](const TSharedRef<FGenRequestSubscriber>& Subscriber) { return Subscriber->Id == SubscriberId; });
+}
+
+FGenRequestHandle FGenRequestEngineBase::Subscribe(const TSharedRef<FGenRequestContext>& Context, const FGenRequestOptions& Options,
+                                                   FGenResponseCallback ResponseCallback, FGenDeltaCallback DeltaCallback)
+{
+	static uint32 NextSubscriberId = 0;
+
+	const TSharedRef<FGenRequestSubscriber> Subscriber = MakeShared<FGenRequestSubscriber>();
+	Subscriber->Id = ++NextSubscriberId;
+	Subscriber->ResponseCallback = MoveTemp(ResponseCallback);
+	Subscriber->DeltaCallback = MoveTemp(DeltaCallback);
+	Subscriber->Owner = Context;
+	Context->Subscribers.Add(Subscriber);
+	FGenRequestHandle Handle(Context, Subscriber->Id);
+
+	if (Options.CancellationToken.IsCancelled())
+	{
+		Complete(Context, FGenParsedResponse::Failure(TEXT("Request cancelled")));
+		return Handle;
+	}
+
+	// Both only hold the subscriber weakly, a caller that got its result or left disarms them in ReleaseSubscriber
+	const TWeakPtr<FGenRequestSubscriber> WeakSubscriber = Subscriber;
+	if (Options.DeadlineSeconds > 0.0f)
+	{
+		const float DeadlineSeconds = Options.DeadlineSeconds;
+		Subscriber->DeadlineTime = FPlatformTime::Seconds() + DeadlineSeconds;
+		Subscriber->DeadlineTimer = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakSubscriber, DeadlineSeconds](float)
+		{
+			if (const TSharedPtr<FGenRequestSubscriber> Pinned = WeakSubscriber.Pin())
+			{
+				Pinned->DeadlineTimer.Reset();
+			}
+			Abort(WeakSubscriber, FString::Printf(TEXT("Request deadline of %.1f s exceeded"), DeadlineSeconds));
+			return false;
+		}), DeadlineSeconds);
+	}
+	if (Options.CancellationToken.IsValid())
+	{
+		Subscriber->CancellationToken = Options.CancellationToken;
+		Subscriber->CancellationBinding = Options.CancellationToken.AddOnCancelled(FSimpleDelegate::CreateLambda([WeakSubscriber]()
+		{
+			Abort(WeakSubscriber, TEXT("Request cancelled"));
+		}));
+	}
+	return Handle;
+}
+
+void FGenRequestEngineBase::Abort(const TWeakPtr<FGenRequestSubscriber>& WeakSubscriber, const FString& Error)
+{
+	const TSharedPtr<FGenRequestSubscriber> Subscriber = WeakSubscriber.Pin();
+	const TSharedPtr<FGenRequestContext> Context = Subscriber.IsValid() ? Subscriber->Owner.Pin() : nullptr;
+	if (!Context.IsValid() || Context->bCompleted || !Context->Subscribers.Contains(Subscriber.ToSharedRef()))
+	{
+		return;
+	}
+
+	UE_LOG(LogGenAIVerbose, Log, TEXT("%s request aborted: %s"), Context->Policy.ProviderName, *Error);
+	Unsubscribe(Context.ToSharedRef(), Subscriber->Id);
+	if (Subscriber->ResponseCallback)
+	{
+		Subscriber->ResponseCallback(FString(), Error, false);
+	}
+}
+
+void FGenRequestEngineBase::Unsubscribe(const TSharedRef<FGenRequestContext>& Context, uint32 SubscriberId)
+{
+	if (Context->bCompleted)
+	{
+		return;
+	}
+
+	Context->Subscribers.RemoveAll([SubscriberId](const TSharedRef<FGenRequestSubscriber>& Subscriber)
+	{
+		if (Subscriber->Id != SubscriberId)
+		{
+			return false;
+		}
+		ReleaseSubscriber(*Subscriber);
+		return true;
+	});
+	if (Context->Subscribers.Num() > 0)
+	{
+		return;
+	}
+
+	// Last caller gone, nobody is left to deliver to
+	Context->bCompleted = true;
+	RemoveInFlight(*Context);
+	FGenTrace::EndRequestRegion(Context->TraceRegion);
+	if (FGenRequestScheduler::Get().Withdraw(Context->Policy.Org, Context->SchedulerTicket))
+	{
+		FGenTrace::RequestDequeued();
+		return;
+	}
+	if (const TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = Context->HttpRequest.Pin())
+	{
+		if (HttpRequest->GetStatus() == EHttpRequestStatus::Processing)
+		{
+			HttpRequest->CancelRequest();
+		}
+	}
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> FGenRequestEngineBase::CreateHttpRequest(const FString& Url, float TimeoutSeconds)
+{
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetVerb(TEXT("POST"));
+	HttpRequest->SetURL(Url);
+	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	if (GetDefault<UGenerativeAISupportRuntimeSettings>()->bAcceptCompressedResponses)
+	{
+		HttpRequest->SetHeader(TEXT("Accept-Encoding"), TEXT("gzip"));
+	}
+	if (TimeoutSeconds > 0.0f)
+	{
+		HttpRequest->SetTimeout(TimeoutSeconds);
+	}
+	return HttpRequest;
+}
+
+void FGenRequestEngineBase::SetRequestBody(FGenRequestContext& Context, IHttpRequest& HttpRequest, TArray<uint8>&& Payload)
+{
+	const int64 UncompressedBytes = Payload.Num();
+	if (FGenCompression::ShouldCompressRequest(Context.Policy.Org, Payload.Num()))
+	{
+		GENAI_TRACE_SCOPE("GenAI::CompressRequest");
+		TArray<uint8> Compressed;
+		if (FGenCompression::GzipCompress(Payload, Compressed) && Compressed.Num() < Payload.Num())
+		{
+			HttpRequest.SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+			Payload = MoveTemp(Compressed);
+		}
+	}
+	FGenCompression::RecordRequest(UncompressedBytes, Payload.Num());
+	Context.Timings.RequestBytes = UncompressedBytes;
+	Context.Timings.RequestWireBytes = Payload.Num();
+	HttpRequest.SetContent(MoveTemp(Payload));
+}
+
+void FGenRequestEngineBase::Start(const TSharedRef<FGenRequestContext>& Context, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest)
+{
+	Context->HttpRequest = HttpRequest;
+	if (Context->bCoalesce)
+	{
+		GetInFlightRequests().Add(Context->CoalesceKey, Context);
+	}
+
+	if (UE_LOG_ACTIVE(LogGenAIVerbose, Log) && HttpRequest->GetHeader(TEXT("Content-Encoding")).IsEmpty())
+	{
+		const TArray<uint8>& Content = HttpRequest->GetContent();
+		const FUTF8ToTCHAR Payload(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+		UE_LOG(LogGenAIVerbose, Log, TEXT("%s request payload: %s"), Context->Policy.ProviderName, *FString(Payload.Length(), Payload.Get()));
+	}
+
+	// The body goes to a sink instead of the response, so it can be read while the request is still running
+	const TSharedRef<FGenResponseBodySink> BodySink = MakeShared<FGenResponseBodySink>();
+	const bool bHasBodySink = HttpRequest->SetResponseBodyReceiveStream(BodySink);
+	// Chunks are taken as the HTTP thread writes them, the progress callback only sees what piled up since the last tick
+	const bool bRecordChunks = !Context->CassetteKey.IsEmpty() && FGenCassette::Get().GetMode() == EGenCassetteMode::Record;
+	BodySink->SetRecordChunks(bRecordChunks);
+	Context->ReceivedBody.Reset();
+
+	// Streamed responses are decoded as the body grows so deltas reach the caller while generation is still running,
+	// the others only note when their first byte arrived
+	HttpRequest->OnRequestProgress64().BindLambda(
+		[Context, BodySink](FHttpRequestPtr Request, uint64 BytesSent, uint64 BytesReceived)
+		{
+			if (BytesReceived == 0 || Context->bCompleted)
+			{
+				return;
+			}
+			if (Context->Timings.FirstByteTime == 0.0)
+			{
+				Context->Timings.FirstByteTime = FPlatformTime::Seconds();
+			}
+			const int32 PreviousBytes = Context->ReceivedBody.Num();
+			if (!BodySink->Drain(Context->ReceivedBody))
+			{
+				return;
+			}
+			if (Context->bStream)
+			{
+				ConsumeStream(Context, TConstArrayView<uint8>(Context->ReceivedBody).RightChop(PreviousBytes), false);
+			}
+		});
+
+	HttpRequest->OnProcessRequestComplete().BindLambda(
+		[Context, BodySink, bHasBodySink, bRecordChunks](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+		{
+			// Safe to read now, without a sink (backends that do not support one) the body only arrives here
+			const int32 PreviousBytes = Context->ReceivedBody.Num();
+			if (bHasBodySink)
+			{
+				BodySink->Drain(Context->ReceivedBody);
+			}
+			else if (Response.IsValid())
+			{
+				Context->ReceivedBody = Response->GetContent();
+			}
+			if (Context->bStream && !Context->bCompleted)
+			{
+				ConsumeStream(Context, TConstArrayView<uint8>(Context->ReceivedBody).RightChop(PreviousBytes), false);
+			}
+			// Chunk boundaries and timing, so a replay hands the parser the same pieces at the same pace
+			if (bRecordChunks)
+			{
+				BodySink->GetChunks(Context->Timings.SendTime, Context->CassetteChunks);
+			}
+			FGenTrace::RequestFinished();
+			FGenTrace::AddBytesReceived(Context->ReceivedBody.Num());
+			FGenRateLimiter::Get().UpdateFromResponse(Context->Policy.Org, Context->ApiKeyHash, Response);
+			FGenRequestScheduler::Get().Release(Context->Policy.Org);
+			HandleCompletion(Context, Response, bSucceeded);
+		});
+
+	if (Context->TraceRegion.IsEmpty() && Context->Attempt == 0)
+	{
+		Context->TraceRegion = FGenTrace::BeginRequestRegion(Context->Policy.ProviderName, Context->Model);
+	}
+	FGenTrace::RequestQueued();
+
+	Context->Timings.EnqueueTime = FPlatformTime::Seconds();
+	if (Context->Timings.SubmitTime == 0.0)
+	{
+		Context->Timings.SubmitTime = Context->Timings.EnqueueTime;
+	}
+
+	// The queue keeps the request alive until it is sent
+	Context->SchedulerTicket = FGenRequestScheduler::Get().Submit(Context->Policy.Org, Context->Options, Context->ApiKeyHash,
+	                                                              Context->EstimatedTokens, [Context, HttpRequest]()
+	{
+		Context->Timings.SendTime = FPlatformTime::Seconds();
+		Context->Timings.QueueSeconds += Context->Timings.SendTime - Context->Timings.EnqueueTime;
+		FGenTrace::RequestDequeued();
+		FGenTrace::RequestSent();
+		FGenTrace::AddBytesSent(HttpRequest->GetContentLength());
+		HttpRequest->ProcessRequest();
+	});
+}
+
+void FGenRequestEngineBase::Complete(const TSharedRef<FGenRequestContext>& Context, const FGenParsedResponse& Result)
+{
+	if (Context->bCompleted)
+	{
+		return;
+	}
+	GENAI_TRACE_SCOPE("GenAI::Complete");
+	Context->bCompleted = true;
+	RemoveInFlight(*Context);
+	FGenTrace::EndRequestRegion(Context->TraceRegion);
+
+	// Only requests that went out, not cache hits or requests that failed before sending
+	if (Context->Timings.SendTime > 0.0)
+	{
+		RecordMetrics(*Context, Result);
+	}
+
+	const bool bWritesCache = Context->CachePolicy == EGenCachePolicy::ReadWrite || Context->CachePolicy == EGenCachePolicy::Refresh;
+	if (Result.bSuccess && bWritesCache)
+	{
+		FGenResponseCache::Get().Store(Context->RequestKey, Result.Content);
+	}
+
+	GENAI_TRACE_SCOPE("GenAI::DeliverResult");
+	const TArray<TSharedRef<FGenRequestSubscriber>> Subscribers = MoveTemp(Context->Subscribers);
+	for (const TSharedRef<FGenRequestSubscriber>& Subscriber : Subscribers)
+	{
+		ReleaseSubscriber(*Subscriber);
+	}
+	for (const TSharedRef<FGenRequestSubscriber>& Subscriber : Subscribers)
+	{
+		if (Subscriber->ResponseCallback)
+		{
+			Subscriber->ResponseCallback(Result.Content, Result.Error, Result.bSuccess);
+		}
+	}
+}
+
+void FGenRequestEngineBase::ResolveRequestKey(const TSharedRef<FGenRequestContext>& Context, const FGenRequestOptions& Options,
+                                              const FString& Url, TConstArrayView<uint8> Payload, uint32 ApiKeyHash)
+{
+	Context->Options = Options;
+	Context->CachePolicy = Options.CachePolicy;
+	Context->bCoalesce = Options.bCoalesceIdenticalRequests;
+	if (Context->CachePolicy != EGenCachePolicy::Bypass || Context->bCoalesce)
+	{
+		Context->RequestKey = FGenResponseCache::ComputeKey(Url, Payload);
+	}
+	if (Context->bCoalesce)
+	{
+		Context->CoalesceKey = FString::Printf(TEXT("%08x-%s"), ApiKeyHash, *Context->RequestKey);
+	}
+}
+
+bool FGenRequestEngineBase::TryCompleteFromCache(const TSharedRef<FGenRequestContext>& Context)
+{
+	if (Context->CachePolicy != EGenCachePolicy::ReadWrite && Context->CachePolicy != EGenCachePolicy::ReadOnly)
+	{
+		return false;
+	}
+
+	FString CachedContent;
+	if (!FGenResponseCache::Get().Find(Context->RequestKey, CachedContent))
+	{
+		return false;
+	}
+
+	UE_LOG(LogGenAIVerbose, Log, TEXT("%s request served from response cache (%s)"), Context->Policy.ProviderName, *Context->RequestKey);
+	FGenTrace::CacheHit();
+
+	// Streaming callers still get their delta, just all of it at once
+	if (Context->bStream)
+	{
+		FGenChatStreamDelta Delta;
+		Delta.Content = CachedContent;
+		const TArray<TSharedRef<FGenRequestSubscriber>> Subscribers = Context->Subscribers;
+		for (const TSharedRef<FGenRequestSubscriber>& Subscriber : Subscribers)
+		{
+			if (Subscriber->DeltaCallback)
+			{
+				Subscriber->DeltaCallback(Delta);
+			}
+		}
+	}
+
+	// Never write a hit back
+	Context->CachePolicy = EGenCachePolicy::ReadOnly;
+	Complete(Context, FGenParsedResponse::Success(MoveTemp(CachedContent)));
+	return true;
+}
+
+bool FGenRequestEngineBase::TryJoinInFlight(const TSharedRef<FGenRequestContext>& Context, FGenRequestHandle& InOutHandle)
+{
+	if (!Context->bCoalesce)
+	{
+		return false;
+	}
+
+	const TWeakPtr<FGenRequestContext>* Registered = GetInFlightRequests().Find(Context->CoalesceKey);
+	const TSharedPtr<FGenRequestContext> InFlight = Registered ? Registered->Pin() : nullptr;
+	if (!InFlight.IsValid() || InFlight->bCompleted)
+	{
+		return false;
+	}
+
+	UE_LOG(LogGenAIVerbose, Log, TEXT("%s request joined an identical in-flight request (%s)"), Context->Policy.ProviderName, *Context->CoalesceKey);
+	FGenTrace::RequestCoalesced();
+
+	// A stream that is already under way is caught up with everything decoded so far
+	FGenChatStreamDelta CatchUp;
+	if (InFlight->bStream)
+	{
+		CatchUp.Content = InFlight->StreamState.Content;
+		CatchUp.ReasoningContent = InFlight->StreamState.ReasoningContent;
+	}
+
+	// The new request's context is dropped, its caller now waits on the in-flight one
+	const TArray<TSharedRef<FGenRequestSubscriber>> Subscribers = MoveTemp(Context->Subscribers);
+	Context->bCompleted = true;
+	for (const TSharedRef<FGenRequestSubscriber>& Subscriber : Subscribers)
+	{
+		Subscriber->Owner = InFlight;
+	}
+	InFlight->Subscribers.Append(Subscribers);
+	InOutHandle.Context = InFlight;
+
+	if (!CatchUp.IsEmpty())
+	{
+		for (const TSharedRef<FGenRequestSubscriber>& Subscriber : Subscribers)
+		{
+			if (Subscriber->DeltaCallback)
+			{
+				Subscriber->DeltaCallback(CatchUp);
+			}
+		}
+	}
+
+	return true;
+}
+
+void FGenRequestEngineBase::ConsumeStream(const TSharedRef<FGenRequestContext>& Context, TConstArrayView<uint8> NewBytes, bool bFinal)
+{
+	GENAI_TRACE_SCOPE("GenAI::ConsumeStream");
+	FGenRequestContext& State = *Context;
+	const auto OnEvent = [&State](const FGenSSEEvent& Event)
+	{
+		// Every caller left or ran out of time, the rest of the body is not worth parsing
+		if (State.StreamState.bDone || State.bCompleted)
+		{
+			return;
+		}
+
+		FGenChatStreamDelta Delta;
+		const double ParseStart = FPlatformTime::Seconds();
+		State.Policy.HandleStreamEvent(Event, State.StreamState, Delta);
+		const double ParseEnd = FPlatformTime::Seconds();
+		State.Timings.ParseSeconds += ParseEnd - ParseStart;
+		if (Delta.IsEmpty())
+		{
+			return;
+		}
+		if (State.Timings.FirstTokenTime == 0.0 && (!Delta.Content.IsEmpty() || !Delta.ReasoningContent.IsEmpty()))
+		{
+			State.Timings.FirstTokenTime = ParseEnd;
+		}
+
+		// Iterate a snapshot, a delta callback may cancel its own handle
+		GENAI_TRACE_SCOPE("GenAI::DeliverDelta");
+		const TArray<TSharedRef<FGenRequestSubscriber>> Subscribers = State.Subscribers;
+		for (const TSharedRef<FGenRequestSubscriber>& Subscriber : Subscribers)
+		{
+			if (Subscriber->DeltaCallback && State.Subscribers.Contains(Subscriber))
+			{
+				Subscriber->DeltaCallback(Delta);
+			}
+		}
+	};
+
+	// The first bytes tell whether the backend passed a gzip body through undecoded, they are held until there are enough
+	if (!State.bStreamEncodingKnown)
+	{
+		State.StreamHead.Append(NewBytes.GetData(), NewBytes.Num());
+		if (State.StreamHead.Num() < 2 && !bFinal)
+		{
+			return;
+		}
+		State.bStreamEncodingKnown = true;
+		if (FGenCompression::IsGzip(State.StreamHead))
+		{
+			State.StreamInflater = MakeUnique<FGenStreamInflater>();
+		}
+		NewBytes = State.StreamHead;
+	}
+
+	if (NewBytes.Num() > 0)
+	{
+		if (!State.StreamInflater.IsValid())
+		{
+			State.SSEParser.Feed(NewBytes.GetData(), NewBytes.Num(), OnEvent);
+		}
+		else
+		{
+			if (!State.StreamInflater->Inflate(NewBytes.GetData(), NewBytes.Num(), State.InflatedChunk))
+			{
+				UE_LOG(LogGenAI, Warning, TEXT("%s stream: corrupt compressed body"), State.Policy.ProviderName);
+			}
+			State.SSEParser.Feed(State.InflatedChunk.GetData(), State.InflatedChunk.Num(), OnEvent);
+		}
+	}
+	State.StreamHead.Empty();
+
+	if (bFinal)
+	{
+		State.SSEParser.Flush(OnEvent);
+	}
+}
+
+void FGenRequestEngineBase::HandleCompletion(const TSharedRef<FGenRequestContext>& Context, const FHttpResponsePtr& Response, bool bSucceeded)
+{
+	GENAI_TRACE_SCOPE("GenAI::HandleCompletion");
+
+	// Every caller cancelled, the request was torn down on purpose
+	if (Context->bCompleted || TryScheduleRetry(Context, Response))
+	{
+		return;
+	}
+
+	const bool bReceived = bSucceeded && Response.IsValid();
+	const int32 ResponseCode = Response.IsValid() ? Response->GetResponseCode() : -1;
+	const TArray<uint8>& Content = Context->ReceivedBody;
+	if (Response.IsValid() && Context->Timings.FirstByteTime == 0.0)
+	{
+		Context->Timings.FirstByteTime = FPlatformTime::Seconds();
+	}
+
+	if (!Context->CassetteKey.IsEmpty() && FGenCassette::Get().GetMode() == EGenCassetteMode::Record)
+	{
+		RecordToCassette(*Context, bReceived, ResponseCode, Content);
+	}
+	FinishResponse(Context, bReceived, ResponseCode, Content);
+}
+
+void FGenRequestEngineBase::FinishResponse(const TSharedRef<FGenRequestContext>& Context, bool bReceived, int32 ResponseCode, const TArray<uint8>& Content)
+{
+	const TCHAR* ProviderName = Context->Policy.ProviderName;
+	Context->Timings.ResponseWireBytes = Content.Num();
+
+	if (!bReceived)
+	{
+		FString ErrorMessage = TEXT("Request failed. No response received.");
+		if (ResponseCode == 0)
+		{
+			ErrorMessage = TEXT("Request most likely timed out. No response received.");
+		}
+		else if (Content.Num() > 0)
+		{
+			const FUTF8ToTCHAR Body(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+			ErrorMessage = FString(Body.Length(), Body.Get());
+		}
+		UE_LOG(LogGenAI, Error, TEXT("%s request failed. HTTP Code: %d, Error: %s"), ProviderName, ResponseCode, *ErrorMessage);
+		Complete(Context, FGenParsedResponse::Failure(ErrorMessage));
+		return;
+	}
+
+	if (Context->bStream)
+	{
+		// Every byte was fed as it arrived, only a trailing event is left
+		ConsumeStream(Context, TConstArrayView<uint8>(), true);
+
+		// Errors raised before the stream starts (auth, rate limits, bad requests) come back as a plain JSON body
+		if (Context->SSEParser.HasReceivedEvents())
+		{
+			const int64 WireBytes = Content.Num();
+			FGenCompression::RecordResponse(WireBytes, Context->StreamInflater.IsValid() ? Context->StreamInflater->GetTotalOut() : WireBytes);
+
+			const FGenStreamState& StreamState = Context->StreamState;
+			FGenUsageTracker::Record(Context->Policy.Org, StreamState.Usage);
+			if (!StreamState.ErrorMessage.IsEmpty())
+			{
+				UE_LOG(LogGenAI, Error, TEXT("%s stream failed: %s"), ProviderName, *StreamState.ErrorMessage);
+				Complete(Context, FGenParsedResponse::Failure(StreamState.ErrorMessage));
+			}
+			else
+			{
+				Complete(Context, FGenParsedResponse::Success(StreamState.Content));
+			}
+			return;
+		}
+	}
+
+	TArray<uint8> InflatedContent;
+	const double ParseStart = FPlatformTime::Seconds();
+	FGenParsedResponse Result;
+	{
+		GENAI_TRACE_SCOPE("GenAI::ParseResponse");
+		Result = Context->Policy.ParseResponse(GetDecodedContent(Content, InflatedContent));
+	}
+	Context->Timings.ParseSeconds += FPlatformTime::Seconds() - ParseStart;
+	FGenUsageTracker::Record(Context->Policy.Org, Result.Usage);
+	if (!Result.bSuccess)
+	{
+		UE_LOG(LogGenAI, Error, TEXT("%s request failed. HTTP Code: %d, Error: %s"), ProviderName, ResponseCode, *Result.Error);
+	}
+	Complete(Context, Result);
+}
+
+bool FGenRequestEngineBase::TryReplayFromCassette(const TSharedRef<FGenRequestContext>& Context, const FString& Url, TConstArrayView<uint8> Payload)
+{
+	FGenCassette& Cassette = FGenCassette::Get();
+	if (Cassette.GetMode() == EGenCassetteMode::Off)
+	{
+		return false;
+	}
+
+	Context->CassetteKey = Context->RequestKey.IsEmpty() ? FGenResponseCache::ComputeKey(Url, Payload) : Context->RequestKey;
+	if (Cassette.GetMode() != EGenCassetteMode::Replay)
+	{
+		return false;
+	}
+
+	const TSharedPtr<const FGenCassetteEntry> Entry = Cassette.FindReplay(Context->CassetteKey);
+	if (!Entry.IsValid())
+	{
+		if (Cassette.IsPassthrough())
+		{
+			// Not replayed, so it must not be recorded either
+			Context->CassetteKey.Reset();
+			return false;
+		}
+		UE_LOG(LogGenAI, Warning, TEXT("%s request %s is not on the cassette"), Context->Policy.ProviderName, *Context->CassetteKey);
+		Complete(Context, FGenParsedResponse::Failure(FString::Printf(TEXT("%s request is not on the replayed cassette"), Context->Policy.ProviderName)));
+		return true;
+	}
+
+	Replay(Context, Entry.ToSharedRef(), Cassette.GetReplaySpeed());
+	return true;
+}
+
+void FGenRequestEngineBase::Replay(const TSharedRef<FGenRequestContext>& Context, const TSharedRef<const FGenCassetteEntry>& Entry, float Speed)
+{
+	if (Context->bCoalesce)
+	{
+		GetInFlightRequests().Add(Context->CoalesceKey, Context);
+	}
+
+	// Replays skip the scheduler, they are sent the moment they are submitted
+	const double Now = FPlatformTime::Seconds();
+	Context->Timings.SubmitTime = Now;
+	Context->Timings.EnqueueTime = Now;
+	Context->Timings.SendTime = Now;
+
+	// Delivered from the ticker like an HTTP response would be, never from within Send
+	const TSharedRef<TArray<uint8>> Received = MakeShared<TArray<uint8>>();
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Context, Entry, Speed, Received, NextChunk = 0](float) mutable
+	{
+		if (Context->bCompleted)
+		{
+			return false;
+		}
+
+		const double Elapsed = FPlatformTime::Seconds() - Context->Timings.SendTime;
+		const auto IsDue = [Elapsed, Speed](float Seconds) { return Speed <= 0.0f || Elapsed >= Seconds / Speed; };
+		while (NextChunk < Entry->Chunks.Num() && IsDue(Entry->Chunks[NextChunk].Seconds))
+		{
+			const int32 EndOffset = FMath::Min(Entry->Chunks[NextChunk++].EndOffset, Entry->Body.Num());
+			if (EndOffset <= Received->Num())
+			{
+				continue;
+			}
+			const int32 PreviousBytes = Received->Num();
+			Received->Append(Entry->Body.GetData() + PreviousBytes, EndOffset - PreviousBytes);
+			if (Context->Timings.FirstByteTime == 0.0)
+			{
+				Context->Timings.FirstByteTime = FPlatformTime::Seconds();
+			}
+			if (Context->bStream)
+			{
+				ConsumeStream(Context, TConstArrayView<uint8>(*Received).RightChop(PreviousBytes), false);
+				// A delta callback may have cancelled the last handle
+				if (Context->bCompleted)
+				{
+					return false;
+				}
+			}
+		}
+		if (NextChunk < Entry->Chunks.Num() || !IsDue(Entry->TotalSeconds))
+		{
+			return true;
+		}
+
+		if (Received->Num() < Entry->Body.Num())
+		{
+			const int32 PreviousBytes = Received->Num();
+			Received->Append(Entry->Body.GetData() + PreviousBytes, Entry->Body.Num() - PreviousBytes);
+			if (Context->bStream)
+			{
+				ConsumeStream(Context, TConstArrayView<uint8>(*Received).RightChop(PreviousBytes), false);
+				if (Context->bCompleted)
+				{
+					return false;
+				}
+			}
+		}
+		if (Entry->bReceived && Context->Timings.FirstByteTime == 0.0)
+		{
+			Context->Timings.FirstByteTime = FPlatformTime::Seconds();
+		}
+		FinishResponse(Context, Entry->bReceived, Entry->ResponseCode, *Received);
+		return false;
+	}));
+}
+
+bool FGenRequestEngineBase::TryScheduleRetry(const TSharedRef<FGenRequestContext>& Context, const FHttpResponsePtr& Response)
+{
+	const TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Previous = Context->HttpRequest.Pin();
+	if (!Previous.IsValid() || !Response.IsValid() || !IsRetryableResponseCode(Response->GetResponseCode())
+		|| Context->Attempt >= Context->Options.MaxRetries)
+	{
+		return false;
+	}
+
+	// Deltas of a partially streamed response already reached the callers, a retry would repeat them
+	if (Context->SSEParser.HasReceivedEvents())
+	{
+		return false;
+	}
+
+	// Full jitter, so the retries of a burst that failed together do not come back together
+	const TCHAR* ProviderName = Context->Policy.ProviderName;
+	const UGenerativeAISupportRuntimeSettings* Settings = GetDefault<UGenerativeAISupportRuntimeSettings>();
+	const double Backoff = FMath::Min<double>(Settings->RetryMaxDelaySeconds, Settings->RetryBaseDelaySeconds * FMath::Pow(2.0, Context->Attempt));
+	const double Delay = FMath::Max(FMath::FRandRange(0.0, Backoff), FGenRateLimiter::GetRetryAfterSeconds(Response));
+
+	// A retry nobody is left waiting for by the time it is sent only costs quota
+	double LatestDeadline = 0.0;
+	for (const TSharedRef<FGenRequestSubscriber>& Subscriber : Context->Subscribers)
+	{
+		LatestDeadline = Subscriber->DeadlineTime > 0.0 ? FMath::Max(LatestDeadline, Subscriber->DeadlineTime) : TNumericLimits<double>::Max();
+	}
+	if (LatestDeadline > 0.0 && FPlatformTime::Seconds() + Delay >= LatestDeadline)
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("%s request failed with HTTP %d, a retry in %.2f s would miss the deadline"), ProviderName,
+		       Response->GetResponseCode(), Delay);
+		return false;
+	}
+
+	if (!FGenRateLimiter::Get().TryWithdrawRetryBudget())
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("%s request failed with HTTP %d, retry budget exhausted"), ProviderName, Response->GetResponseCode());
+		return false;
+	}
+
+	++Context->Attempt;
+
+	UE_LOG(LogGenAI, Warning, TEXT("%s request failed with HTTP %d, retry %d/%d in %.2f s"), ProviderName, Response->GetResponseCode(),
+	       Context->Attempt, Context->Options.MaxRetries, Delay);
+
+	// A finished request cannot be sent again, send a copy
+	const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Retry = CreateHttpRequest(Previous->GetURL(), Context->TimeoutSeconds);
+	for (const FString& Header : Previous->GetAllHeaders())
+	{
+		FString Name;
+		FString Value;
+		if (Header.Split(TEXT(":"), &Name, &Value))
+		{
+			Retry->SetHeader(Name.TrimStartAndEnd(), Value.TrimStartAndEnd());
+		}
+	}
+	Retry->SetContent(Previous->GetContent());
+
+	Context->SSEParser.Reset();
+	Context->StreamState = FGenStreamState();
+	Context->bStreamEncodingKnown = false;
+	Context->StreamInflater.Reset();
+	Context->StreamHead.Reset();
+	Context->CassetteChunks.Reset();
+	Context->Timings.FirstByteTime = 0.0;
+	Context->Timings.FirstTokenTime = 0.0;
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Context, Retry](float)
+	{
+		if (!Context->bCompleted)
+		{
+			Start(Context, Retry);
+		}
+		return false;
+	}), static_cast<float>(Delay));
+	return true;
+}
@@ -0,0 +1,239 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenRequestMetrics.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Utilities/GenGlobalDefinitions.h"
+
+namespace
+{
+	struct FModelMetrics
+	{
+		int64 Requests = 0;
+		int64 Failures = 0;
+
+		// Ring buffer, oldest sample at NextSlot once full
+		TArray<FGenRequestSample> Samples;
+		int32 NextSlot = 0;
+
+		template <typename TFunc>
+		void ForEachSample(TFunc&& Func) const
+		{
+			const int32 Start = Samples.Num() < FGenRequestMetrics::MaxSamplesPerModel ? 0 : NextSlot;
+			for (int32 Offset = 0; Offset < Samples.Num(); ++Offset)
+			{
+				Func(Samples[(Start + Offset) % Samples.Num()]);
+			}
+		}
+	};
+
+	using FModelKey = TPair<FString, FString>;
+
+	TMap<FModelKey, FModelMetrics>& GetMutableMetrics()
+	{
+		static TMap<FModelKey, FModelMetrics> Metrics;
+		return Metrics;
+	}
+
+	FGenMetricPercentiles ComputePercentiles(const FModelMetrics& Metrics, float FGenRequestSample::* Field)
+	{
+		TArray<float> Values;
+		Values.Reserve(Metrics.Samples.Num());
+		for (const FGenRequestSample& Sample : Metrics.Samples)
+		{
+			if (Sample.bSuccess && Sample.*Field >= 0.0f)
+			{
+				Values.Add(Sample.*Field);
+			}
+		}
+
+		FGenMetricPercentiles Result;
+		Result.Count = Values.Num();
+		if (Values.Num() == 0)
+		{
+			return Result;
+		}
+
+		// Nearest rank, a window holds a few hundred samples so sorting on demand is cheap
+		Values.Sort();
+		const auto Rank = [&Values](double Percentile)
+		{
+			return Values[FMath::Clamp(FMath::CeilToInt32(Values.Num() * Percentile) - 1, 0, Values.Num() - 1)];
+		};
+		Result.P50 = Rank(0.50);
+		Result.P95 = Rank(0.95);
+		Result.P99 = Rank(0.99);
+		Result.Max = Values.Last();
+		return Result;
+	}
+
+	FString FormatPercentiles(const FGenMetricPercentiles& Percentiles)
+	{
+		return Percentiles.Count > 0
+			? FString::Printf(TEXT("%9.1f %9.1f %9.1f %9.1f"), Percentiles.P50, Percentiles.P95, Percentiles.P99, Percentiles.Max)
+			: FString::Printf(TEXT("%9s %9s %9s %9s"), TEXT("-"), TEXT("-"), TEXT("-"), TEXT("-"));
+	}
+
+	void RunStatsCommand(const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			FGenRequestMetrics::Reset();
+			UE_LOG(LogGenPerformance, Display, TEXT("Request metrics reset"));
+		}
+		else if (Args.Num() > 0 && Args[0] == TEXT("csv"))
+		{
+			FString WrittenPath;
+			if (FGenRequestMetrics::WriteCsv(Args.Num() > 1 ? Args[1] : FString(), &WrittenPath))
+			{
+				UE_LOG(LogGenPerformance, Display, TEXT("Request metrics written to %s"), *WrittenPath);
+			}
+		}
+		else
+		{
+			FGenRequestMetrics::LogSummaries();
+		}
+	}
+
+	FAutoConsoleCommand GenAIStatsCommand(
+		TEXT("GenAI.Stats"),
+		TEXT("Logs latency and throughput percentiles per provider and model. Args: [csv [Path] | reset]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunStatsCommand));
+}
+
+void FGenRequestMetrics::Record(const FString& Provider, const FString& Model, const FGenRequestSample& Sample)
+{
+	FModelMetrics& Metrics = GetMutableMetrics().FindOrAdd(FModelKey(Provider, Model));
+	++Metrics.Requests;
+	Metrics.Failures += Sample.bSuccess ? 0 : 1;
+	if (Metrics.Samples.Num() < MaxSamplesPerModel)
+	{
+		Metrics.Samples.Add(Sample);
+	}
+	else
+	{
+		Metrics.Samples[Metrics.NextSlot] = Sample;
+		Metrics.NextSlot = (Metrics.NextSlot + 1) % MaxSamplesPerModel;
+	}
+
+	UE_LOG(LogGenPerformance, Verbose, TEXT("%s %s: %s, queue %.0f ms, first byte %.0f ms, first token %.0f ms, total %.0f ms, %s tokens/s, %.0f / %.0f bytes, parse %.2f ms"),
+	       *Provider, *Model, Sample.bSuccess ? TEXT("ok") : TEXT("failed"), Sample.QueueMs, Sample.TimeToFirstByteMs, Sample.TimeToFirstTokenMs,
+	       Sample.TotalMs, Sample.TokensPerSecond >= 0.0f ? *FString::Printf(TEXT("%.1f"), Sample.TokensPerSecond) : TEXT("unknown"),
+	       Sample.RequestBytes, Sample.ResponseBytes, Sample.ParseMs);
+}
+
+TArray<FGenRequestMetricsSummary> FGenRequestMetrics::GetSummaries()
+{
+	TArray<FGenRequestMetricsSummary> Summaries;
+	for (const TPair<FModelKey, FModelMetrics>& Pair : GetMutableMetrics())
+	{
+		const FModelMetrics& Metrics = Pair.Value;
+		FGenRequestMetricsSummary& Summary = Summaries.AddDefaulted_GetRef();
+		Summary.Provider = Pair.Key.Key;
+		Summary.Model = Pair.Key.Value;
+		Summary.Requests = Metrics.Requests;
+		Summary.Failures = Metrics.Failures;
+		Summary.QueueMs = ComputePercentiles(Metrics, &FGenRequestSample::QueueMs);
+		Summary.TimeToFirstByteMs = ComputePercentiles(Metrics, &FGenRequestSample::TimeToFirstByteMs);
+		Summary.TimeToFirstTokenMs = ComputePercentiles(Metrics, &FGenRequestSample::TimeToFirstTokenMs);
+		Summary.TotalMs = ComputePercentiles(Metrics, &FGenRequestSample::TotalMs);
+		Summary.TokensPerSecond = ComputePercentiles(Metrics, &FGenRequestSample::TokensPerSecond);
+		Summary.RequestBytes = ComputePercentiles(Metrics, &FGenRequestSample::RequestBytes);
+		Summary.ResponseBytes = ComputePercentiles(Metrics, &FGenRequestSample::ResponseBytes);
+		Summary.ParseMs = ComputePercentiles(Metrics, &FGenRequestSample::ParseMs);
+	}
+	Summaries.Sort([](const FGenRequestMetricsSummary& A, const FGenRequestMetricsSummary& B)
+	{
+		return A.Provider != B.Provider ? A.Provider < B.Provider : A.Model < B.Model;
+	});
+	return Summaries;
+}
+
+void FGenRequestMetrics::Reset()
+{
+	GetMutableMetrics().Reset();
+}
+
+void FGenRequestMetrics::LogSummaries()
+{
+	const TArray<FGenRequestMetricsSummary> Summaries = GetSummaries();
+	if (Summaries.Num() == 0)
+	{
+		UE_LOG(LogGenPerformance, Display, TEXT("No requests recorded"));
+		return;
+	}
+
+	for (const FGenRequestMetricsSummary& Summary : Summaries)
+	{
+		UE_LOG(LogGenPerformance, Display, TEXT("%s %s: %lld requests, %lld failed"), *Summary.Provider, *Summary.Model, Summary.Requests, Summary.Failures);
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %9s %9s %9s %9s"), TEXT(""), TEXT("p50"), TEXT("p95"), TEXT("p99"), TEXT("max"));
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %s"), TEXT("queue ms"), *FormatPercentiles(Summary.QueueMs));
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %s"), TEXT("first byte ms"), *FormatPercentiles(Summary.TimeToFirstByteMs));
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %s"), TEXT("first token ms"), *FormatPercentiles(Summary.TimeToFirstTokenMs));
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %s"), TEXT("total ms"), *FormatPercentiles(Summary.TotalMs));
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %s"), TEXT("tokens/s"), *FormatPercentiles(Summary.TokensPerSecond));
+		if (Summary.TokensPerSecond.Count < Summary.TotalMs.Count)
+		{
+			// Requests whose provider reported no usage are left out rather than counted as 0 tokens/s
+			UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %d of %d requests reported no usage, their throughput is unknown"), TEXT(""),
+			       Summary.TotalMs.Count - Summary.TokensPerSecond.Count, Summary.TotalMs.Count);
+		}
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %s"), TEXT("request bytes"), *FormatPercentiles(Summary.RequestBytes));
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %s"), TEXT("response bytes"), *FormatPercentiles(Summary.ResponseBytes));
+		UE_LOG(LogGenPerformance, Display, TEXT("  %-20s %s"), TEXT("parse ms"), *FormatPercentiles(Summary.ParseMs));
+	}
+}
+
+bool FGenRequestMetrics::WriteCsv(const FString& FilePath, FString* OutWrittenPath)
+{
+	const FString Path = !FilePath.IsEmpty()
+		? FilePath
+		: FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("GenAI"), TEXT("Metrics"),
+		                  FString::Printf(TEXT("RequestMetrics-%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+
+	FString Csv = TEXT("timestamp,provider,model,success,stream,attempts,output_tokens,queue_ms,ttfb_ms,ttft_ms,total_ms,tokens_per_second,request_bytes,response_bytes,parse_ms\n");
+	for (const TPair<FModelKey, FModelMetrics>& Pair : GetMutableMetrics())
+	{
+		Pair.Value.ForEachSample([&Csv, &Pair](const FGenRequestSample& Sample)
+		{
+			// Missing metrics stay empty instead of -1 so spreadsheets do not average them in
+			const auto Field = [](float Value) { return Value >= 0.0f ? FString::Printf(TEXT("%.3f"), Value) : FString(); };
+			Csv += FString::Printf(TEXT("%s,%s,\"%s\",%d,%d,%d,%s,%s,%s,%s,%s,%s,%s,%s,%s\n"),
+			                       *Sample.Timestamp.ToIso8601(), *Pair.Key.Key, *Pair.Key.Value.Replace(TEXT("\""), TEXT("\"\"")),
+			                       Sample.bSuccess ? 1 : 0, Sample.bStream ? 1 : 0, Sample.Attempts,
+			                       Sample.OutputTokens >= 0 ? *LexToString(Sample.OutputTokens) : TEXT(""),
+			                       *Field(Sample.QueueMs), *Field(Sample.TimeToFirstByteMs), *Field(Sample.TimeToFirstTokenMs), *Field(Sample.TotalMs),
+			                       *Field(Sample.TokensPerSecond), *Field(Sample.RequestBytes), *Field(Sample.ResponseBytes), *Field(Sample.ParseMs));
+		});
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Could not write request metrics to %s"), *Path);
+		return false;
+	}
+	if (OutWrittenPath)
+	{
+		*OutWrittenPath = Path;
+	}
+	return true;
+}
+
+TArray<FGenRequestMetricsSummary> UGenRequestMetricsLibrary::GetRequestMetrics()
+{
+	return FGenRequestMetrics::GetSummaries();
+}
+
+void UGenRequestMetricsLibrary::ResetRequestMetrics()
+{
+	FGenRequestMetrics::Reset();
+}
+
+bool UGenRequestMetricsLibrary::WriteRequestMetricsCsv(const FString& FilePath)
+{
+	return FGenRequestMetrics::WriteCsv(FilePath);
+}
@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenRequestScheduler.h"
+
+#include "Containers/Ticker.h"
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "Misc/ScopeExit.h"
+#include "Network/GenRateLimiter.h"
+#include "Utilities/GenGlobalDefinitions.h"
+
+namespace
+{
+	struct FQueueOrder
+	{
+		template <typename TRequest>
+		bool operator()(const TRequest& A, const TRequest& B) const
+		{
+			return A.FinishTag < B.FinishTag || (A.FinishTag == B.FinishTag && A.Ticket < B.Ticket);
+		}
+	};
+
+	// Waits longer than this are worth a line in the performance log
+	constexpr double SlowAdmissionSeconds = 1.0;
+
+	// A rate limited request that has waited this long stops letting smaller ones on its key overtake it, so they cannot starve it
+	constexpr double MaxYieldSeconds = 10.0;
+}
+
+FGenRequestScheduler& FGenRequestScheduler::Get()
+{
+	static FGenRequestScheduler Instance;
+	return Instance;
+}
+
+uint64 FGenRequestScheduler::Submit(EGenAIOrgs Org, const FGenRequestOptions& Options, uint32 ApiKeyHash, int32 EstimatedTokens,
+                                    TFunction<void()> Dispatch)
+{
+	check(IsInGameThread());
+
+	FLane& Lane = Providers.FindOrAdd(Org).Lanes[static_cast<int32>(Options.Priority)];
+
+	// Weighted fair queuing: each request finishes 1/weight after the later of the lane's virtual time
+	// and the caller's previous request, requests leave the lane in finish tag order
+	double& CallerFinishTag = Lane.LastFinishTags.FindOrAdd(Options.CallerId, 0.0);
+	const double StartTag = FMath::Max(Lane.VirtualTime, CallerFinishTag);
+	CallerFinishTag = StartTag + 1.0 / FMath::Max(Options.CallerWeight, 0.01f);
+
+	FQueuedRequest Request;
+	Request.Ticket = ++NextTicket;
+	Request.FinishTag = CallerFinishTag;
+	Request.EnqueueTime = FPlatformTime::Seconds();
+	Request.ApiKeyHash = ApiKeyHash;
+	Request.EstimatedTokens = EstimatedTokens;
+	Request.Dispatch = MoveTemp(Dispatch);
+	Lane.Queue.HeapPush(MoveTemp(Request), FQueueOrder());
+
+	const uint64 Ticket = NextTicket;
+	Pump(Org);
+	return Ticket;
+}
+
+bool FGenRequestScheduler::Withdraw(EGenAIOrgs Org, uint64 Ticket)
+{
+	check(IsInGameThread());
+
+	FProviderQueue* Provider = Providers.Find(Org);
+	if (!Provider)
+	{
+		return false;
+	}
+
+	for (FLane& Lane : Provider->Lanes)
+	{
+		const int32 Index = Lane.Queue.IndexOfByPredicate([Ticket](const FQueuedRequest& Request) { return Request.Ticket == Ticket; });
+		if (Index != INDEX_NONE)
+		{
+			Lane.Queue.HeapRemoveAt(Index, FQueueOrder());
+			return true;
+		}
+	}
+	return false;
+}
+
+void FGenRequestScheduler::Release(EGenAIOrgs Org)
+{
+	check(IsInGameThread());
+
+	if (FProviderQueue* Provider = Providers.Find(Org))
+	{
+		Provider->InFlight = FMath::Max(0, Provider->InFlight - 1);
+		Pump(Org);
+	}
+}
+
+void FGenRequestScheduler::Pump(EGenAIOrgs Org)
+{
+	// A dispatch that fails synchronously releases its slot from inside this loop, the outer loop picks that up
+	if (Providers.FindChecked(Org).bPumping)
+	{
+		return;
+	}
+	Providers.FindChecked(Org).bPumping = true;
+	ON_SCOPE_EXIT { Providers.FindChecked(Org).bPumping = false; };
+
+	const int32 MaxInFlight = GetDefault<UGenerativeAISupportRuntimeSettings>()->GetMaxConcurrentRequests(Org);
+	while (true)
+	{
+		// Looked up again every round, dispatching can submit requests for other providers and grow the map
+		FProviderQueue& Provider = Providers.FindChecked(Org);
+		if (Provider.InFlight >= MaxInFlight)
+		{
+			return;
+		}
+
+		int32 LaneIndex = 0;
+		while (LaneIndex < NumPriorities && Provider.Lanes[LaneIndex].Queue.IsEmpty())
+		{
+			++LaneIndex;
+		}
+		if (LaneIndex == NumPriorities)
+		{
+			return;
+		}
+
+		// Hold the queue while the provider would reject every waiting request anyway, so bursts are smoothed instead of lost
+		FLane& Lane = Provider.Lanes[LaneIndex];
+		double ThrottleSeconds = 0.0;
+		const int32 NextIndex = AcquireNext(Org, Lane, ThrottleSeconds);
+		if (NextIndex == INDEX_NONE)
+		{
+			if (!Provider.bWakeScheduled)
+			{
+				Provider.bWakeScheduled = true;
+				FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Org](float)
+				{
+					Providers.FindChecked(Org).bWakeScheduled = false;
+					Pump(Org);
+					return false;
+				}), static_cast<float>(ThrottleSeconds));
+			}
+			return;
+		}
+
+		FQueuedRequest Request = MoveTemp(Lane.Queue[NextIndex]);
+		Lane.Queue.HeapRemoveAt(NextIndex, FQueueOrder(), EAllowShrinking::No);
+		// A request that overtook the head may carry a later tag than the ones still waiting
+		Lane.VirtualTime = FMath::Max(Lane.VirtualTime, Request.FinishTag);
+		if (Lane.Queue.IsEmpty())
+		{
+			// Every caller is idle, nothing left to be fair about
+			Lane.LastFinishTags.Reset();
+		}
+		++Provider.InFlight;
+
+		const double WaitSeconds = FPlatformTime::Seconds() - Request.EnqueueTime;
+		FLaneCounters& LaneCounters = Counters[LaneIndex];
+		++LaneCounters.Dispatched;
+		LaneCounters.TotalWaitSeconds += WaitSeconds;
+		LaneCounters.MaxWaitSeconds = FMath::Max(LaneCounters.MaxWaitSeconds, WaitSeconds);
+		if (WaitSeconds > SlowAdmissionSeconds)
+		{
+			UE_LOG(LogGenPerformance, Display, TEXT("%s request waited %.2f s for a free slot (priority %s)"),
+			       *UEnum::GetDisplayValueAsText(Org).ToString(), WaitSeconds,
+			       *UEnum::GetDisplayValueAsText(static_cast<EGenRequestPriority>(LaneIndex)).ToString());
+		}
+
+		Request.Dispatch();
+	}
+}
+
+int32 FGenRequestScheduler::AcquireNext(EGenAIOrgs Org, const FLane& Lane, double& OutThrottleSeconds) const
+{
+	FGenRateLimiter& RateLimiter = FGenRateLimiter::Get();
+	const FQueuedRequest& Head = Lane.Queue.HeapTop();
+	OutThrottleSeconds = RateLimiter.TryAcquire(Org, Head.ApiKeyHash, Head.EstimatedTokens);
+	if (OutThrottleSeconds <= 0.0)
+	{
+		return 0;
+	}
+
+	// The head waits for its budget, later requests that fit what is left go ahead of it in fair queuing order,
+	// only requests on another key or smaller ones can fit, and smaller ones only until the head has waited too long
+	const bool bHeadYields = FPlatformTime::Seconds() - Head.EnqueueTime <= MaxYieldSeconds;
+	TArray<int32, TInlineAllocator<16>> Candidates;
+	for (int32 Index = 1; Index < Lane.Queue.Num(); ++Index)
+	{
+		const FQueuedRequest& Request = Lane.Queue[Index];
+		if (Request.ApiKeyHash != Head.ApiKeyHash || (bHeadYields && Request.EstimatedTokens < Head.EstimatedTokens))
+		{
+			Candidates.Add(Index);
+		}
+	}
+	Candidates.Sort([&Lane](int32 A, int32 B) { return FQueueOrder()(Lane.Queue[A], Lane.Queue[B]); });
+
+	for (const int32 Index : Candidates)
+	{
+		const FQueuedRequest& Request = Lane.Queue[Index];
+		const double ThrottleSeconds = RateLimiter.TryAcquire(Org, Request.ApiKeyHash, Request.EstimatedTokens);
+		if (ThrottleSeconds <= 0.0)
+		{
+			return Index;
+		}
+		// Wake up for whichever request gets its budget first
+		OutThrottleSeconds = FMath::Min(OutThrottleSeconds, ThrottleSeconds);
+	}
+	return INDEX_NONE;
+}
+
+FGenSchedulerStats FGenRequestScheduler::GetStats() const
+{
+	FGenSchedulerStats Stats;
+	Stats.Lanes.SetNum(NumPriorities);
+	for (int32 LaneIndex = 0; LaneIndex < NumPriorities; ++LaneIndex)
+	{
+		const FLaneCounters& LaneCounters = Counters[LaneIndex];
+		FGenSchedulerLaneStats& LaneStats = Stats.Lanes[LaneIndex];
+		LaneStats.Priority = static_cast<EGenRequestPriority>(LaneIndex);
+		LaneStats.DispatchedRequests = LaneCounters.Dispatched;
+		LaneStats.AverageWaitSeconds = LaneCounters.Dispatched > 0 ? static_cast<float>(LaneCounters.TotalWaitSeconds / LaneCounters.Dispatched) : 0.0f;
+		LaneStats.MaxWaitSeconds = static_cast<float>(LaneCounters.MaxWaitSeconds);
+	}
+
+	for (const TPair<EGenAIOrgs, FProviderQueue>& Provider : Providers)
+	{
+		Stats.InFlightRequests += Provider.Value.InFlight;
+		for (int32 LaneIndex = 0; LaneIndex < NumPriorities; ++LaneIndex)
+		{
+			const int32 QueueDepth = Provider.Value.Lanes[LaneIndex].Queue.Num();
+			Stats.Lanes[LaneIndex].QueueDepth += QueueDepth;
+			Stats.QueuedRequests += QueueDepth;
+		}
+	}
+	return Stats;
+}
+
+FGenSchedulerStats UGenRequestSchedulerLibrary::GetRequestSchedulerStats()
+{
+	return FGenRequestScheduler::Get().GetStats();
+}
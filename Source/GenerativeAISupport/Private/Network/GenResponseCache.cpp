@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenResponseCache.h"
+
+#include "Async/Async.h"
+#include "GenerativeAISupportRuntimeSettings.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenTrace.h"
+
+FGenResponseCache& FGenResponseCache::Get()
+{
+	static FGenResponseCache Instance;
+	return Instance;
+}
+
+FGenResponseCache::FGenResponseCache()
+	: MemoryCache(GetDefault<UGenerativeAISupportRuntimeSettings>()->ResponseCacheMaxEntries)
+	, DiskDirectory(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("GenAI"), TEXT("ResponseCache")))
+	, bPersistToDisk(GetDefault<UGenerativeAISupportRuntimeSettings>()->bPersistResponseCache)
+{
+	if (bPersistToDisk)
+	{
+		LoadDiskIndex();
+	}
+}
+
+FString FGenResponseCache::ComputeKey(const FString& Url, TConstArrayView<uint8> Payload)
+{
+	const FTCHARToUTF8 UrlUtf8(*Url);
+
+	FSHA1 Hasher;
+	Hasher.Update(reinterpret_cast<const uint8*>(UrlUtf8.Get()), UrlUtf8.Length());
+	Hasher.Update(reinterpret_cast<const uint8*>("\n"), 1);
+	Hasher.Update(Payload.GetData(), Payload.Num());
+	Hasher.Final();
+
+	FSHAHash Hash;
+	Hasher.GetHash(Hash.Hash);
+	return Hash.ToString();
+}
+
+bool FGenResponseCache::Find(const FString& Key, FString& OutContent)
+{
+	GENAI_TRACE_SCOPE("GenAI::CacheFind");
+	{
+		FScopeLock Lock(&CriticalSection);
+		if (const FString* Cached = MemoryCache.FindAndTouch(Key))
+		{
+			OutContent = *Cached;
+			++Stats.MemoryHits;
+			return true;
+		}
+	}
+
+	bool bOnDisk;
+	{
+		FScopeLock Lock(&CriticalSection);
+		bOnDisk = DiskKeys.Contains(Key);
+	}
+
+	// Only read files the index knows about, misses never touch the disk
+	const bool bLoaded = bOnDisk && FFileHelper::LoadFileToString(OutContent, *GetEntryPath(Key));
+
+	FScopeLock Lock(&CriticalSection);
+	if (bLoaded)
+	{
+		MemoryCache.Add(Key, OutContent);
+		++Stats.DiskHits;
+		return true;
+	}
+	if (bOnDisk)
+	{
+		// Deleted behind our back, the next store indexes it again
+		DiskKeys.Remove(Key);
+	}
+	++Stats.Misses;
+	return false;
+}
+
+void FGenResponseCache::Store(const FString& Key, const FString& Content)
+{
+	GENAI_TRACE_SCOPE("GenAI::CacheStore");
+	{
+		FScopeLock Lock(&CriticalSection);
+		MemoryCache.Add(Key, Content);
+		++Stats.Stores;
+		if (bPersistToDisk)
+		{
+			DiskKeys.Add(Key);
+		}
+	}
+
+	if (bPersistToDisk)
+	{
+		// Keep file IO off the game thread, the memory tier already serves this entry
+		Async(EAsyncExecution::ThreadPool, [Path = GetEntryPath(Key), Content]()
+		{
+			if (!FFileHelper::SaveStringToFile(Content, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			{
+				UE_LOG(LogGenAI, Warning, TEXT("Failed to persist cached response to %s"), *Path);
+			}
+		});
+	}
+}
+
+void FGenResponseCache::Clear(bool bIncludeDisk)
+{
+	{
+		FScopeLock Lock(&CriticalSection);
+		MemoryCache.Empty(GetDefault<UGenerativeAISupportRuntimeSettings>()->ResponseCacheMaxEntries);
+		Stats = FGenCacheStats();
+		if (bIncludeDisk)
+		{
+			DiskKeys.Empty();
+		}
+	}
+
+	if (bIncludeDisk)
+	{
+		IFileManager::Get().DeleteDirectory(*DiskDirectory, false, true);
+	}
+}
+
+FGenCacheStats FGenResponseCache::GetStats() const
+{
+	FScopeLock Lock(&CriticalSection);
+	FGenCacheStats Result = Stats;
+	Result.MemoryEntries = MemoryCache.Num();
+	return Result;
+}
+
+FString FGenResponseCache::GetEntryPath(const FString& Key) const
+{
+	// Fan out over 256 sub directories to keep directory listings small
+	return FPaths::Combine(DiskDirectory, Key.Left(2), Key + TEXT(".txt"));
+}
+
+void FGenResponseCache::LoadDiskIndex()
+{
+	Async(EAsyncExecution::ThreadPool, [this, Directory = DiskDirectory]()
+	{
+		TArray<FString> Files;
+		IFileManager::Get().FindFilesRecursive(Files, *Directory, TEXT("*.txt"), true, false);
+
+		FScopeLock Lock(&CriticalSection);
+		// Appended, entries stored while the scan ran are already in the index
+		DiskKeys.Reserve(DiskKeys.Num() + Files.Num());
+		for (const FString& File : Files)
+		{
+			DiskKeys.Add(FPaths::GetBaseFilename(File));
+		}
+		UE_LOG(LogGenAIVerbose, Log, TEXT("Response cache indexed %d entries on disk"), Files.Num());
+	});
+}
+
+FGenCacheStats UGenResponseCacheLibrary::GetResponseCacheStats()
+{
+	return FGenResponseCache::Get().GetStats();
+}
+
+void UGenResponseCacheLibrary::ClearResponseCache(bool bIncludeDisk)
+{
+	FGenResponseCache::Get().Clear(bIncludeDisk);
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Network/GenUsageTracker.h"
+
+#include "Utilities/GenGlobalDefinitions.h"
+
+namespace
+{
+	TMap<EGenAIOrgs, FGenTokenUsageStats>& GetMutableStats()
+	{
+		static TMap<EGenAIOrgs, FGenTokenUsageStats> Stats;
+		return Stats;
+	}
+}
+
+void FGenUsageTracker::Record(EGenAIOrgs Org, const FGenTokenUsage& Usage)
+{
+	if (!Usage.IsSet())
+	{
+		return;
+	}
+
+	FGenTokenUsageStats& Stats = GetMutableStats().FindOrAdd(Org);
+	++Stats.Requests;
+	Stats.InputTokens += Usage.InputTokens;
+	Stats.OutputTokens += Usage.OutputTokens;
+	Stats.CacheCreationInputTokens += Usage.CacheCreationInputTokens;
+	Stats.CacheReadInputTokens += Usage.CacheReadInputTokens;
+	Stats.CacheHitRequests += Usage.CacheReadInputTokens > 0 ? 1 : 0;
+
+	UE_LOG(LogGenAIVerbose, Log, TEXT("Usage: %lld input, %lld output, %lld cache write, %lld cache read tokens"),
+	       Usage.InputTokens, Usage.OutputTokens, Usage.CacheCreationInputTokens, Usage.CacheReadInputTokens);
+}
+
+FGenTokenUsageStats FGenUsageTracker::GetStats(EGenAIOrgs Org)
+{
+	FGenTokenUsageStats Stats = GetMutableStats().FindRef(Org);
+	const int64 PromptTokens = Stats.InputTokens + Stats.CacheCreationInputTokens + Stats.CacheReadInputTokens;
+	Stats.CacheHitRate = PromptTokens > 0 ? static_cast<float>(static_cast<double>(Stats.CacheReadInputTokens) / PromptTokens) : 0.0f;
+	return Stats;
+}
+
+void FGenUsageTracker::ResetStats()
+{
+	GetMutableStats().Reset();
+}
+
+FGenTokenUsageStats UGenUsageLibrary::GetTokenUsageStats(EGenAIOrgs Org)
+{
+	return FGenUsageTracker::GetStats(Org);
+}
+
+void UGenUsageLibrary::ResetTokenUsageStats()
+{
+	FGenUsageTracker::ResetStats();
+}
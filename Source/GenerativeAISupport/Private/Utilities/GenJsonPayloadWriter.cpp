@@ -0,0 +1,181 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Utilities/GenJsonPayloadWriter.h"
+
+FGenJsonPayloadWriter::FGenJsonPayloadWriter(TArray<uint8>& InBuffer)
+	: Buffer(InBuffer)
+{
+}
+
+void FGenJsonPayloadWriter::BeginObject()
+{
+	WriteSeparator();
+	Buffer.Add('{');
+	NeedsComma.Add(false);
+}
+
+void FGenJsonPayloadWriter::BeginObject(FStringView Name)
+{
+	WriteName(Name);
+	Buffer.Add('{');
+	NeedsComma.Add(false);
+}
+
+void FGenJsonPayloadWriter::EndObject()
+{
+	Buffer.Add('}');
+	NeedsComma.Pop(EAllowShrinking::No);
+}
+
+void FGenJsonPayloadWriter::BeginArray(FStringView Name)
+{
+	WriteName(Name);
+	Buffer.Add('[');
+	NeedsComma.Add(false);
+}
+
+void FGenJsonPayloadWriter::EndArray()
+{
+	Buffer.Add(']');
+	NeedsComma.Pop(EAllowShrinking::No);
+}
+
+void FGenJsonPayloadWriter::WriteString(FStringView Name, FStringView Value)
+{
+	WriteName(Name);
+	WriteQuoted(Value);
+}
+
+void FGenJsonPayloadWriter::WriteNumber(FStringView Name, int32 Value)
+{
+	WriteName(Name);
+	ANSICHAR Digits[16];
+	const int32 Length = FCStringAnsi::Snprintf(Digits, UE_ARRAY_COUNT(Digits), "%d", Value);
+	WriteAscii(Digits, Length);
+}
+
+void FGenJsonPayloadWriter::WriteNumber(FStringView Name, float Value)
+{
+	WriteName(Name);
+	if (!FMath::IsFinite(Value))
+	{
+		// Not representable in JSON
+		WriteAscii("0", 1);
+		return;
+	}
+
+	// Seven significant digits print what the user typed (0.7f as 0.7, not 0.699999988)
+	ANSICHAR Digits[32];
+	const int32 Length = FCStringAnsi::Snprintf(Digits, UE_ARRAY_COUNT(Digits), "%.7g", Value);
+	WriteAscii(Digits, Length);
+}
+
+void FGenJsonPayloadWriter::WriteBool(FStringView Name, bool Value)
+{
+	WriteName(Name);
+	if (Value)
+	{
+		WriteAscii("true", 4);
+	}
+	else
+	{
+		WriteAscii("false", 5);
+	}
+}
+
+void FGenJsonPayloadWriter::WriteRawJson(FStringView Name, FStringView Json)
+{
+	WriteName(Name);
+	WriteUtf8(Json.TrimStartAndEnd());
+}
+
+void FGenJsonPayloadWriter::WriteRawJson(FStringView Name, TConstArrayView<uint8> Utf8Json)
+{
+	WriteName(Name);
+	Buffer.Append(Utf8Json.GetData(), Utf8Json.Num());
+}
+
+void FGenJsonPayloadWriter::WriteSeparator()
+{
+	if (NeedsComma.Num() > 0)
+	{
+		if (NeedsComma.Last())
+		{
+			Buffer.Add(',');
+		}
+		NeedsComma.Last() = true;
+	}
+}
+
+void FGenJsonPayloadWriter::WriteName(FStringView Name)
+{
+	WriteSeparator();
+	if (!Name.IsEmpty())
+	{
+		WriteQuoted(Name);
+		Buffer.Add(':');
+	}
+}
+
+void FGenJsonPayloadWriter::WriteQuoted(FStringView Value)
+{
+	// Plain text is the common case, escapes and multi byte characters only grow the reservation
+	Buffer.Reserve(Buffer.Num() + Value.Len() + 2);
+	Buffer.Add('"');
+
+	const TCHAR* Chars = Value.GetData();
+	const int32 Length = Value.Len();
+	int32 RunStart = 0;
+	for (int32 Index = 0; Index < Length; ++Index)
+	{
+		const TCHAR Char = Chars[Index];
+		// Everything else, non ASCII included, goes out with its run and is UTF-8 encoded in bulk
+		if (Char >= 0x20 && Char != TEXT('"') && Char != TEXT('\\'))
+		{
+			continue;
+		}
+
+		WriteUtf8(FStringView(Chars + RunStart, Index - RunStart));
+		RunStart = Index + 1;
+
+		switch (Char)
+		{
+		case TEXT('"'): WriteAscii("\\\"", 2); break;
+		case TEXT('\\'): WriteAscii("\\\\", 2); break;
+		case TEXT('\n'): WriteAscii("\\n", 2); break;
+		case TEXT('\r'): WriteAscii("\\r", 2); break;
+		case TEXT('\t'): WriteAscii("\\t", 2); break;
+		case TEXT('\b'): WriteAscii("\\b", 2); break;
+		case TEXT('\f'): WriteAscii("\\f", 2); break;
+		default:
+			{
+				ANSICHAR Escaped[8];
+				const int32 EscapedLength = FCStringAnsi::Snprintf(Escaped, UE_ARRAY_COUNT(Escaped), "\\u%04x", static_cast<uint32>(Char));
+				WriteAscii(Escaped, EscapedLength);
+			}
+			break;
+		}
+	}
+	WriteUtf8(FStringView(Chars + RunStart, Length - RunStart));
+
+	Buffer.Add('"');
+}
+
+void FGenJsonPayloadWriter::WriteUtf8(FStringView Value)
+{
+	if (Value.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 Utf8Length = FPlatformString::ConvertedLength<UTF8CHAR>(Value.GetData(), Value.Len());
+	const int32 Offset = Buffer.AddUninitialized(Utf8Length);
+	FPlatformString::Convert(reinterpret_cast<UTF8CHAR*>(Buffer.GetData() + Offset), Utf8Length, Value.GetData(), Value.Len());
+}
+
+void FGenJsonPayloadWriter::WriteAscii(const ANSICHAR* Text, int32 Length)
+{
+	Buffer.Append(reinterpret_cast<const uint8*>(Text), Length);
+}
@@ -0,0 +1,535 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Utilities/GenJsonPullReader.h"
+
+#include "Containers/StringConv.h"
+
+namespace
+{
+	using FUtf8Buffer = TArray<ANSICHAR, TInlineAllocator<256>>;
+
+	bool ReadHex4(const ANSICHAR* Text, int32 Available, uint32& OutValue)
+	{
+		if (Available < 4)
+		{
+			return false;
+		}
+
+		OutValue = 0;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const ANSICHAR Char = Text[Index];
+			uint32 Digit;
+			if (Char >= '0' && Char <= '9')
+			{
+				Digit = Char - '0';
+			}
+			else if (Char >= 'a' && Char <= 'f')
+			{
+				Digit = Char - 'a' + 10;
+			}
+			else if (Char >= 'A' && Char <= 'F')
+			{
+				Digit = Char - 'A' + 10;
+			}
+			else
+			{
+				return false;
+			}
+			OutValue = OutValue << 4 | Digit;
+		}
+		return true;
+	}
+
+	void AppendUtf8(FUtf8Buffer& Out, uint32 CodePoint)
+	{
+		if (CodePoint < 0x80)
+		{
+			Out.Add(static_cast<ANSICHAR>(CodePoint));
+		}
+		else if (CodePoint < 0x800)
+		{
+			Out.Add(static_cast<ANSICHAR>(0xC0 | CodePoint >> 6));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Out.Add(static_cast<ANSICHAR>(0xE0 | CodePoint >> 12));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint >> 6 & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			Out.Add(static_cast<ANSICHAR>(0xF0 | CodePoint >> 18));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint >> 12 & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint >> 6 & 0x3F)));
+			Out.Add(static_cast<ANSICHAR>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+
+	FString Utf8ToString(const ANSICHAR* Text, int32 Length)
+	{
+		if (Length <= 0)
+		{
+			return FString();
+		}
+		const FUTF8ToTCHAR Converter(Text, Length);
+		return FString(Converter.Length(), Converter.Get());
+	}
+
+	enum class EExtractResult : uint8
+	{
+		Continue,
+		Done,
+		Error
+	};
+
+	using FActiveQueries = TArray<FGenJsonFieldQuery*, TInlineAllocator<8>>;
+
+	struct FFieldExtractor
+	{
+		explicit FFieldExtractor(TConstArrayView<uint8> Json)
+			: Reader(Json)
+		{
+		}
+
+		FGenJsonPullReader Reader;
+		int32 Remaining = 0;
+
+		// Reader has to be positioned on the first token of the value, Depth is the number of path segments matched so far
+		EExtractResult ReadValue(const FActiveQueries& Active, int32 Depth)
+		{
+			const EGenJsonToken ValueToken = Reader.GetToken();
+			bool bDescend = false;
+			for (FGenJsonFieldQuery* Query : Active)
+			{
+				if (Query->Segments.Num() > Depth)
+				{
+					bDescend = true;
+					continue;
+				}
+
+				Query->bFound = true;
+				Query->ValueType = ValueToken;
+				if (ValueToken == EGenJsonToken::String)
+				{
+					Query->Value = Reader.GetString();
+				}
+				else if (ValueToken != EGenJsonToken::ObjectStart && ValueToken != EGenJsonToken::ArrayStart)
+				{
+					Query->Value = Utf8ToString(Reader.GetRawValue().GetData(), Reader.GetRawValue().Len());
+				}
+				--Remaining;
+			}
+
+			if (Remaining == 0)
+			{
+				return EExtractResult::Done;
+			}
+			if (!bDescend || (ValueToken != EGenJsonToken::ObjectStart && ValueToken != EGenJsonToken::ArrayStart))
+			{
+				return Reader.SkipValue() ? EExtractResult::Continue : EExtractResult::Error;
+			}
+			return ReadChildren(Active, Depth, ValueToken == EGenJsonToken::ObjectStart);
+		}
+
+		EExtractResult ReadChildren(const FActiveQueries& Active, int32 Depth, bool bObject)
+		{
+			FActiveQueries Matching;
+			for (int32 Index = 0;; ++Index)
+			{
+				const EGenJsonToken Token = Reader.Next();
+				if (Token == EGenJsonToken::ObjectEnd || Token == EGenJsonToken::ArrayEnd)
+				{
+					return EExtractResult::Continue;
+				}
+				if (Token == EGenJsonToken::Error || Token == EGenJsonToken::End || (bObject && Token != EGenJsonToken::Key))
+				{
+					return EExtractResult::Error;
+				}
+
+				// Queries answered further up (first match wins for wildcards) drop out here
+				Matching.Reset();
+				for (FGenJsonFieldQuery* Query : Active)
+				{
+					if (Query->bFound || Query->Segments.Num() <= Depth)
+					{
+						continue;
+					}
+					const FGenJsonFieldQuery::FSegment& Segment = Query->Segments[Depth];
+					const bool bMatches = bObject
+						? Segment.Name.Equals(Reader.GetRawValue(), ESearchCase::CaseSensitive)
+						: Segment.bAnyIndex || Segment.Index == Index;
+					if (bMatches)
+					{
+						Matching.Add(Query);
+					}
+				}
+
+				if (bObject)
+				{
+					if (Matching.IsEmpty())
+					{
+						if (!Reader.SkipNextValue())
+						{
+							return EExtractResult::Error;
+						}
+						continue;
+					}
+					Reader.Next();
+				}
+				else if (Matching.IsEmpty())
+				{
+					if (!Reader.SkipValue())
+					{
+						return EExtractResult::Error;
+					}
+					continue;
+				}
+
+				// Matching is reused by the next sibling, the nested call gets its own copy
+				const EExtractResult Result = ReadValue(FActiveQueries(Matching), Depth + 1);
+				if (Result != EExtractResult::Continue)
+				{
+					return Result;
+				}
+			}
+		}
+	};
+}
+
+FGenJsonPullReader::FGenJsonPullReader(TConstArrayView<uint8> InJson)
+	: Data(reinterpret_cast<const ANSICHAR*>(InJson.GetData()))
+	, Length(InJson.Num())
+{
+}
+
+EGenJsonToken FGenJsonPullReader::Next()
+{
+	if (Token == EGenJsonToken::End || Token == EGenJsonToken::Error)
+	{
+		return Token;
+	}
+
+	SkipSeparators();
+	if (Position >= Length)
+	{
+		// Running out of input is only fine after a complete top level value
+		return Token != EGenJsonToken::None && Containers.Num() == 0 ? Token = EGenJsonToken::End : Fail();
+	}
+
+	RawValue.Reset();
+	switch (Data[Position])
+	{
+	case '{':
+		++Position;
+		Containers.Add(true);
+		bExpectKey = true;
+		return Token = EGenJsonToken::ObjectStart;
+
+	case '[':
+		++Position;
+		Containers.Add(false);
+		bExpectKey = false;
+		return Token = EGenJsonToken::ArrayStart;
+
+	case '}':
+	case ']':
+		{
+			const bool bObject = Data[Position] == '}';
+			if (Containers.Num() == 0 || Containers.Last() != bObject)
+			{
+				return Fail();
+			}
+			++Position;
+			Containers.Pop(EAllowShrinking::No);
+			FinishValue();
+			return Token = bObject ? EGenJsonToken::ObjectEnd : EGenJsonToken::ArrayEnd;
+		}
+
+	case '"':
+		return ReadString(bExpectKey ? EGenJsonToken::Key : EGenJsonToken::String);
+
+	case 't':
+		return ReadLiteral("true", 4, EGenJsonToken::True);
+
+	case 'f':
+		return ReadLiteral("false", 5, EGenJsonToken::False);
+
+	case 'n':
+		return ReadLiteral("null", 4, EGenJsonToken::Null);
+
+	default:
+		return ReadNumber();
+	}
+}
+
+FString FGenJsonPullReader::GetString() const
+{
+	if (Token != EGenJsonToken::Key && Token != EGenJsonToken::String)
+	{
+		return FString();
+	}
+	if (!bRawValueHasEscapes)
+	{
+		return Utf8ToString(RawValue.GetData(), RawValue.Len());
+	}
+
+	const ANSICHAR* Raw = RawValue.GetData();
+	const int32 RawLength = RawValue.Len();
+	FUtf8Buffer Decoded;
+	Decoded.Reserve(RawLength);
+
+	int32 RunStart = 0;
+	for (int32 Index = 0; Index < RawLength; ++Index)
+	{
+		if (Raw[Index] != '\\')
+		{
+			continue;
+		}
+
+		Decoded.Append(Raw + RunStart, Index - RunStart);
+		// ReadString guarantees that a backslash is never the last raw byte
+		const ANSICHAR Escaped = Raw[++Index];
+		RunStart = Index + 1;
+
+		switch (Escaped)
+		{
+		case 'n': Decoded.Add('\n'); break;
+		case 'r': Decoded.Add('\r'); break;
+		case 't': Decoded.Add('\t'); break;
+		case 'b': Decoded.Add('\b'); break;
+		case 'f': Decoded.Add('\f'); break;
+		case 'u':
+			{
+				uint32 CodePoint;
+				if (!ReadHex4(Raw + Index + 1, RawLength - Index - 1, CodePoint))
+				{
+					// Keep malformed escapes as they are
+					Decoded.Add('\\');
+					Decoded.Add('u');
+					break;
+				}
+				Index += 4;
+
+				if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+				{
+					// Characters outside the BMP come as an escaped surrogate pair
+					uint32 LowSurrogate;
+					if (Index + 2 < RawLength && Raw[Index + 1] == '\\' && Raw[Index + 2] == 'u'
+						&& ReadHex4(Raw + Index + 3, RawLength - Index - 3, LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+					{
+						CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+						Index += 6;
+					}
+					else
+					{
+						CodePoint = 0xFFFD;
+					}
+				}
+				else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+				{
+					CodePoint = 0xFFFD;
+				}
+				AppendUtf8(Decoded, CodePoint);
+				RunStart = Index + 1;
+			}
+			break;
+		default:
+			// '"', '\\' and '/'
+			Decoded.Add(Escaped);
+			break;
+		}
+	}
+	Decoded.Append(Raw + RunStart, RawLength - RunStart);
+
+	return Utf8ToString(Decoded.GetData(), Decoded.Num());
+}
+
+bool FGenJsonPullReader::SkipValue()
+{
+	switch (Token)
+	{
+	case EGenJsonToken::String:
+	case EGenJsonToken::Number:
+	case EGenJsonToken::True:
+	case EGenJsonToken::False:
+	case EGenJsonToken::Null:
+		return true;
+
+	case EGenJsonToken::ObjectStart:
+	case EGenJsonToken::ArrayStart:
+		{
+			// The container is already on the stack, done once it has been popped again
+			const int32 Depth = Containers.Num();
+			while (Containers.Num() >= Depth)
+			{
+				const EGenJsonToken Skipped = Next();
+				if (Skipped == EGenJsonToken::Error || Skipped == EGenJsonToken::End)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	default:
+		return false;
+	}
+}
+
+bool FGenJsonPullReader::SkipNextValue()
+{
+	Next();
+	return SkipValue();
+}
+
+void FGenJsonPullReader::SkipSeparators()
+{
+	while (Position < Length)
+	{
+		const ANSICHAR Char = Data[Position];
+		if (Char != ' ' && Char != '\n' && Char != '\r' && Char != '\t' && Char != ',' && Char != ':')
+		{
+			return;
+		}
+		++Position;
+	}
+}
+
+void FGenJsonPullReader::FinishValue()
+{
+	bExpectKey = Containers.Num() > 0 && Containers.Last();
+}
+
+EGenJsonToken FGenJsonPullReader::ReadString(EGenJsonToken StringToken)
+{
+	const int32 Start = ++Position;
+	bRawValueHasEscapes = false;
+	while (Position < Length)
+	{
+		const ANSICHAR Char = Data[Position];
+		if (Char == '"')
+		{
+			RawValue = FAnsiStringView(Data + Start, Position - Start);
+			++Position;
+			if (StringToken == EGenJsonToken::Key)
+			{
+				bExpectKey = false;
+			}
+			else
+			{
+				FinishValue();
+			}
+			return Token = StringToken;
+		}
+		if (Char == '\\')
+		{
+			bRawValueHasEscapes = true;
+			Position += 2;
+			continue;
+		}
+		++Position;
+	}
+	return Fail();
+}
+
+EGenJsonToken FGenJsonPullReader::ReadLiteral(const ANSICHAR* Literal, int32 LiteralLength, EGenJsonToken LiteralToken)
+{
+	if (Position + LiteralLength > Length || FCStringAnsi::Strncmp(Data + Position, Literal, LiteralLength) != 0)
+	{
+		return Fail();
+	}
+	RawValue = FAnsiStringView(Data + Position, LiteralLength);
+	Position += LiteralLength;
+	FinishValue();
+	return Token = LiteralToken;
+}
+
+EGenJsonToken FGenJsonPullReader::ReadNumber()
+{
+	const int32 Start = Position;
+	while (Position < Length)
+	{
+		const ANSICHAR Char = Data[Position];
+		if ((Char < '0' || Char > '9') && Char != '-' && Char != '+' && Char != '.' && Char != 'e' && Char != 'E')
+		{
+			break;
+		}
+		++Position;
+	}
+	if (Position == Start)
+	{
+		return Fail();
+	}
+	RawValue = FAnsiStringView(Data + Start, Position - Start);
+	FinishValue();
+	return Token = EGenJsonToken::Number;
+}
+
+EGenJsonToken FGenJsonPullReader::Fail()
+{
+	Position = Length;
+	RawValue.Reset();
+	return Token = EGenJsonToken::Error;
+}
+
+FGenJsonFieldQuery::FGenJsonFieldQuery(const ANSICHAR* Path)
+{
+	const FAnsiStringView PathView(Path);
+	int32 SegmentStart = 0;
+	for (int32 Index = 0; Index <= PathView.Len(); ++Index)
+	{
+		if (Index < PathView.Len() && PathView[Index] != '.')
+		{
+			continue;
+		}
+
+		FSegment& Segment = Segments.AddDefaulted_GetRef();
+		Segment.Name = PathView.Mid(SegmentStart, Index - SegmentStart);
+		if (Segment.Name.Len() == 1 && Segment.Name[0] == '*')
+		{
+			Segment.bAnyIndex = true;
+		}
+		else if (!Segment.Name.IsEmpty() && FCharAnsi::IsDigit(Segment.Name[0]))
+		{
+			Segment.Index = FCStringAnsi::Atoi(Segment.Name.GetData());
+		}
+		SegmentStart = Index + 1;
+	}
+}
+
+namespace GenJson
+{
+	bool ExtractFields(TConstArrayView<uint8> Json, TArrayView<FGenJsonFieldQuery* const> Queries)
+	{
+		FActiveQueries Active;
+		for (FGenJsonFieldQuery* Query : Queries)
+		{
+			Query->bFound = false;
+			Query->Value.Reset();
+			Query->ValueType = EGenJsonToken::None;
+			Active.Add(Query);
+		}
+		if (Active.IsEmpty())
+		{
+			return true;
+		}
+
+		FFieldExtractor Extractor(Json);
+		Extractor.Remaining = Active.Num();
+		const EGenJsonToken First = Extractor.Reader.Next();
+		if (First == EGenJsonToken::Error || First == EGenJsonToken::End)
+		{
+			return false;
+		}
+		return Extractor.ReadValue(Active, 0) != EExtractResult::Error;
+	}
+
+	FString ToDebugString(TConstArrayView<uint8> Json)
+	{
+		return Utf8ToString(reinterpret_cast<const ANSICHAR*>(Json.GetData()), Json.Num());
+	}
+}
@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Utilities/GenJsonStreamParser.h"
+
+#include "Containers/StringConv.h"
+#include "Utilities/GenJsonPullReader.h"
+
+namespace
+{
+	// Key without its quotes, escapes are rare in keys so they go through the pull reader
+	FString DecodeKey(FStringView Quoted)
+	{
+		const FStringView Key = Quoted.Mid(1, Quoted.Len() - 2);
+		int32 Backslash;
+		if (!Key.FindChar(TEXT('\\'), Backslash))
+		{
+			return FString(Key);
+		}
+
+		const FTCHARToUTF8 Utf8(Quoted.GetData(), Quoted.Len());
+		FGenJsonPullReader Reader(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()));
+		return Reader.Next() == EGenJsonToken::String ? Reader.GetString() : FString(Key);
+	}
+
+	EJson GetScalarType(TCHAR FirstChar)
+	{
+		switch (FirstChar)
+		{
+		case TEXT('t'):
+		case TEXT('f'):
+			return EJson::Boolean;
+		case TEXT('n'):
+			return EJson::Null;
+		default:
+			return EJson::Number;
+		}
+	}
+}
+
+FString FGenJsonStreamEvent::GetPath() const
+{
+	return Index == INDEX_NONE ? Field : FString::Printf(TEXT("%s[%d]"), *Field, Index);
+}
+
+bool FGenJsonStreamParser::Feed(FStringView InText, FOnValue OnValue)
+{
+	if (bFailed)
+	{
+		return false;
+	}
+
+	Text.Append(InText.GetData(), InText.Len());
+	if (bDone)
+	{
+		return true;
+	}
+
+	const TCHAR* Chars = *Text;
+	for (; Position < Text.Len(); ++Position)
+	{
+		const TCHAR Char = Chars[Position];
+
+		if (bInString)
+		{
+			if (bEscaped)
+			{
+				bEscaped = false;
+			}
+			else if (Char == TEXT('\\'))
+			{
+				bEscaped = true;
+			}
+			else if (Char == TEXT('"'))
+			{
+				bInString = false;
+				if (!bStringIsKey)
+				{
+					EndValue(Position + 1, OnValue);
+				}
+				else if (Stack.Num() == 1)
+				{
+					Field = DecodeKey(FStringView(Chars + StringStart, Position + 1 - StringStart));
+				}
+			}
+			continue;
+		}
+
+		const bool bWhitespace = FChar::IsWhitespace(Char);
+		if (Stack.Num() == 0 && !bWhitespace && Char != TEXT('{') && Char != TEXT('['))
+		{
+			return Fail();
+		}
+
+		// Numbers and literals have no closing character, they end at whatever follows them
+		if (ScalarStart != INDEX_NONE && (bWhitespace || Char == TEXT(',') || Char == TEXT('}') || Char == TEXT(']')))
+		{
+			EndScalar(Position, OnValue);
+		}
+
+		switch (Char)
+		{
+		case TEXT('{'):
+		case TEXT('['):
+			BeginValue(Position, Char == TEXT('{') ? EJson::Object : EJson::Array);
+			Stack.Add(Char);
+			ChildCounts.Add(0);
+			bExpectKey = Char == TEXT('{');
+			break;
+
+		case TEXT('}'):
+		case TEXT(']'):
+			if (Stack.Num() == 0 || Stack.Last() != (Char == TEXT('}') ? TEXT('{') : TEXT('[')))
+			{
+				return Fail();
+			}
+			Stack.Pop(EAllowShrinking::No);
+			ChildCounts.Pop(EAllowShrinking::No);
+			bExpectKey = false;
+			EndValue(Position + 1, OnValue);
+			if (bDone)
+			{
+				// Whatever follows the root is not part of the response
+				Position = Text.Len();
+				return true;
+			}
+			break;
+
+		case TEXT('"'):
+			bInString = true;
+			bEscaped = false;
+			bStringIsKey = bExpectKey;
+			StringStart = Position;
+			if (!bStringIsKey)
+			{
+				BeginValue(Position, EJson::String);
+			}
+			break;
+
+		case TEXT(':'):
+			bExpectKey = false;
+			break;
+
+		case TEXT(','):
+			bExpectKey = Stack.Last() == TEXT('{');
+			break;
+
+		default:
+			if (!bWhitespace && ScalarStart == INDEX_NONE)
+			{
+				BeginValue(Position, GetScalarType(Char));
+				ScalarStart = Position;
+			}
+			break;
+		}
+	}
+	return true;
+}
+
+void FGenJsonStreamParser::Reset()
+{
+	Text.Reset();
+	Position = 0;
+	Stack.Reset();
+	ChildCounts.Reset();
+	Field.Reset();
+	StringStart = INDEX_NONE;
+	ScalarStart = INDEX_NONE;
+	bInString = false;
+	bEscaped = false;
+	bStringIsKey = false;
+	bExpectKey = false;
+	bDone = false;
+	bFailed = false;
+}
+
+void FGenJsonStreamParser::BeginValue(int32 Start, EJson Type)
+{
+	const int32 Depth = Stack.Num();
+	if (Depth <= ReportedDepth)
+	{
+		ValueStarts[Depth] = Start;
+		ValueTypes[Depth] = Type;
+	}
+}
+
+void FGenJsonStreamParser::EndValue(int32 EndPosition, FOnValue OnValue)
+{
+	const int32 Depth = Stack.Num();
+	if (Depth == 0)
+	{
+		bDone = true;
+		return;
+	}
+
+	const int32 Index = ChildCounts[Depth - 1]++;
+	if (Depth > ReportedDepth)
+	{
+		return;
+	}
+
+	FGenJsonStreamEvent Event;
+	if (Depth == 1)
+	{
+		// Root arrays report their elements, root objects their fields
+		if (Stack[0] == TEXT('{'))
+		{
+			Event.Field = Field;
+		}
+		else
+		{
+			Event.Index = Index;
+		}
+	}
+	else if (Stack[0] == TEXT('{') && Stack[1] == TEXT('['))
+	{
+		Event.Field = Field;
+		Event.Index = Index;
+	}
+	else
+	{
+		return;
+	}
+
+	Event.Type = ValueTypes[Depth];
+	Event.Json = Text.Mid(ValueStarts[Depth], EndPosition - ValueStarts[Depth]);
+	OnValue(Event);
+}
+
+void FGenJsonStreamParser::EndScalar(int32 EndPosition, FOnValue OnValue)
+{
+	ScalarStart = INDEX_NONE;
+	EndValue(EndPosition, OnValue);
+}
+
+bool FGenJsonStreamParser::Fail()
+{
+	bFailed = true;
+	return false;
+}
@@ -0,0 +1,264 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+// Microbenchmarks for request body construction and response parsing: the FJsonObject + FString paths the providers used
+// to take against FGenJsonPayloadWriter and FGenJsonPullReader. Run "GenAI.Bench.Payload [Messages] [Iterations] [CharsPerMessage]"
+// or "GenAI.Bench.Parse [ResponseChars] [Iterations]" from the console, results go to LogGenPerformance.
+// "GenAI.Bench.Tokenizer [TextChars] [Iterations]" measures FGenTokenizer throughput. Allocations per run show up in Memory Insights.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Network/GenProviderTraits.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenJsonPayloadWriter.h"
+#include "Utilities/GenTokenizer.h"
+
+namespace
+{
+	struct FBenchResult
+	{
+		double MicrosecondsPerIteration = 0.0;
+		int32 BodyBytes = 0;
+	};
+
+	/**
+	 * Times Body over Iterations runs. Allocations are left to the memory tracer instead of a proxy in GMalloc: run with
+	 * -trace=default,memory,GenAI -llm and Memory Insights shows what each run allocated under the GenAI/Benchmark tag,
+	 * every run is a timing region named after the path it measures.
+	 */
+	template <typename TBody>
+	FBenchResult Measure(const TCHAR* Name, int32 Iterations, TBody&& Body)
+	{
+		// Warm up, so one-off allocations (enum name tables, TLS) do not count against either path
+		FBenchResult Result;
+		Result.BodyBytes = Body();
+
+		const FString Region = FString::Printf(TEXT("GenAI Bench %s"), Name);
+		LLM_SCOPE_BYNAME(TEXT("GenAI/Benchmark"));
+		TRACE_BEGIN_REGION(*Region);
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Body();
+		}
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+		TRACE_END_REGION(*Region);
+
+		Result.MicrosecondsPerIteration = ElapsedSeconds * 1000000.0 / Iterations;
+		return Result;
+	}
+
+	// What FGenOpenAIChatTraits::BuildPayload plus SetContentAsString amounted to before FGenJsonPayloadWriter
+	int32 BuildLegacyPayload(const FGenChatSettings& Settings)
+	{
+		const TSharedRef<FJsonObject> JsonPayload = MakeShared<FJsonObject>();
+		JsonPayload->SetStringField(TEXT("model"), Settings.GetResolvedModel());
+		JsonPayload->SetNumberField(TEXT("max_completion_tokens"), Settings.MaxTokens);
+		JsonPayload->SetNumberField(TEXT("temperature"), Settings.Temperature);
+		JsonPayload->SetNumberField(TEXT("top_p"), Settings.TopP);
+
+		TArray<TSharedPtr<FJsonValue>> MessagesArray;
+		MessagesArray.Reserve(Settings.Messages.Num());
+		for (const FGenChatMessage& Message : Settings.Messages)
+		{
+			const TSharedPtr<FJsonObject> JsonMessage = MakeShareable(new FJsonObject());
+			JsonMessage->SetStringField(TEXT("role"), Message.Role);
+			JsonMessage->SetStringField(TEXT("content"), Message.Content);
+			MessagesArray.Add(MakeShareable(new FJsonValueObject(JsonMessage)));
+		}
+		JsonPayload->SetArrayField(TEXT("messages"), MessagesArray);
+
+		FString PayloadString;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&PayloadString);
+		FJsonSerializer::Serialize(JsonPayload, Writer);
+
+		const FTCHARToUTF8 Converter(*PayloadString);
+		TArray<uint8> Content;
+		Content.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+		return Content.Num();
+	}
+
+	int32 BuildWriterPayload(const FGenChatSettings& Settings, int32& SizeHint)
+	{
+		TArray<uint8> Content;
+		Content.Reserve(SizeHint);
+		FString Error;
+		FGenOpenAIChatTraits::BuildPayload(Settings, Content, Error);
+		SizeHint = Content.Num() + Content.Num() / 4;
+		return Content.Num();
+	}
+
+	void RunPayloadBenchmark(const TArray<FString>& Args)
+	{
+		const int32 NumMessages = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 64;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 200;
+		const int32 CharsPerMessage = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 400;
+
+		// Mostly prose with the odd quote, newline and non ASCII character, like a real conversation
+		const FString Filler = TEXT("The innkeeper leans over the counter and says \"you look like you've travelled far\".\nCaf\u00e9, na\u00efve, d\u00e9j\u00e0 vu. ");
+		FString Content;
+		while (Content.Len() < CharsPerMessage)
+		{
+			Content += Filler;
+		}
+		Content.LeftInline(CharsPerMessage);
+
+		FGenChatSettings Settings;
+		Settings.Messages.Reserve(NumMessages);
+		for (int32 Index = 0; Index < NumMessages; ++Index)
+		{
+			FGenChatMessage& Message = Settings.Messages.AddDefaulted_GetRef();
+			Message.Role = Index == 0 ? TEXT("system") : (Index % 2 ? TEXT("user") : TEXT("assistant"));
+			Message.Content = Content;
+		}
+
+		const FBenchResult Legacy = Measure(TEXT("Payload FJsonObject"), Iterations, [&Settings]() { return BuildLegacyPayload(Settings); });
+		int32 SizeHint = 0;
+		BuildWriterPayload(Settings, SizeHint);
+		const FBenchResult Direct = Measure(TEXT("Payload FGenJsonPayloadWriter"), Iterations, [&Settings, &SizeHint]() { return BuildWriterPayload(Settings, SizeHint); });
+
+		// Same history held in an FGenConversation, only the cached message JSON is copied
+		FGenChatSettings HistorySettings;
+		HistorySettings.History.Append(Settings.Messages);
+		int32 HistorySizeHint = 0;
+		BuildWriterPayload(HistorySettings, HistorySizeHint);
+		const FBenchResult History = Measure(TEXT("Payload FGenConversation"), Iterations, [&HistorySettings, &HistorySizeHint]() { return BuildWriterPayload(HistorySettings, HistorySizeHint); });
+
+		UE_LOG(LogGenPerformance, Display, TEXT("Payload benchmark: %d messages x %d chars, %d iterations"), NumMessages, CharsPerMessage, Iterations);
+		UE_LOG(LogGenPerformance, Display, TEXT("  FJsonObject + pretty FString: %8.1f us, body %d bytes"), Legacy.MicrosecondsPerIteration, Legacy.BodyBytes);
+		UE_LOG(LogGenPerformance, Display, TEXT("  FGenJsonPayloadWriter:        %8.1f us, body %d bytes"), Direct.MicrosecondsPerIteration, Direct.BodyBytes);
+		UE_LOG(LogGenPerformance, Display, TEXT("  FGenConversation history:     %8.1f us, body %d bytes"), History.MicrosecondsPerIteration, History.BodyBytes);
+		if (Direct.MicrosecondsPerIteration > 0.0)
+		{
+			UE_LOG(LogGenPerformance, Display, TEXT("  Speedup %.2fx"), Legacy.MicrosecondsPerIteration / Direct.MicrosecondsPerIteration);
+		}
+	}
+
+	// What FGenChatCompletionsTraits::ParseResponse amounted to before FGenJsonPullReader
+	int32 ParseLegacyResponse(const TArray<uint8>& Body)
+	{
+		// Response->GetContentAsString()
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Body.Num());
+		const FString ResponseStr(Converter.Length(), Converter.Get());
+		TSharedPtr<FJsonObject> JsonObject;
+		FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ResponseStr), JsonObject);
+
+		const TArray<TSharedPtr<FJsonValue>>* ChoicesArray;
+		const TSharedPtr<FJsonObject>* FirstChoice;
+		const TSharedPtr<FJsonObject>* MessageObject;
+		FString Content;
+		if (JsonObject.IsValid() && JsonObject->TryGetArrayField(TEXT("choices"), ChoicesArray) && ChoicesArray->Num() > 0
+			&& (*ChoicesArray)[0]->TryGetObject(FirstChoice) && (*FirstChoice)->TryGetObjectField(TEXT("message"), MessageObject))
+		{
+			(*MessageObject)->TryGetStringField(TEXT("content"), Content);
+		}
+		return Content.Len();
+	}
+
+	void RunParseBenchmark(const TArray<FString>& Args)
+	{
+		const int32 ResponseChars = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 16000;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 200;
+
+		// A structured output style answer: JSON escaped into the content string, followed by the usual trailing fields
+		const FString Filler = TEXT("{\"npc\": \"innkeeper\", \"line\": \"Caf\u00e9 is closed, traveller.\\nCome back at dawn.\"}, ");
+		FString Answer;
+		while (Answer.Len() < ResponseChars)
+		{
+			Answer += Filler;
+		}
+
+		TArray<uint8> Body;
+		FGenJsonPayloadWriter Writer(Body);
+		Writer.BeginObject();
+		Writer.WriteString(TEXT("id"), TEXT("chatcmpl-bench"));
+		Writer.WriteString(TEXT("object"), TEXT("chat.completion"));
+		Writer.BeginArray(TEXT("choices"));
+		Writer.BeginObject();
+		Writer.WriteNumber(TEXT("index"), 0);
+		Writer.BeginObject(TEXT("message"));
+		Writer.WriteString(TEXT("role"), TEXT("assistant"));
+		Writer.WriteString(TEXT("content"), Answer);
+		Writer.EndObject();
+		Writer.WriteString(TEXT("finish_reason"), TEXT("stop"));
+		Writer.EndObject();
+		Writer.EndArray();
+		Writer.BeginObject(TEXT("usage"));
+		Writer.WriteNumber(TEXT("prompt_tokens"), 1200);
+		Writer.WriteNumber(TEXT("completion_tokens"), ResponseChars / 4);
+		Writer.EndObject();
+		Writer.EndObject();
+
+		const FBenchResult Legacy = Measure(TEXT("Parse FJsonObject"), Iterations, [&Body]() { return ParseLegacyResponse(Body); });
+		const FBenchResult Direct = Measure(TEXT("Parse FGenJsonPullReader"), Iterations, [&Body]() { return FGenChatCompletionsTraits::ParseResponse(Body).Content.Len(); });
+
+		UE_LOG(LogGenPerformance, Display, TEXT("Parse benchmark: %d byte response, %d iterations"), Body.Num(), Iterations);
+		UE_LOG(LogGenPerformance, Display, TEXT("  FString + FJsonObject: %8.1f us"), Legacy.MicrosecondsPerIteration);
+		UE_LOG(LogGenPerformance, Display, TEXT("  FGenJsonPullReader:    %8.1f us"), Direct.MicrosecondsPerIteration);
+		// Both bodies return the content length, which lands in BodyBytes
+		if (Legacy.BodyBytes != Direct.BodyBytes)
+		{
+			UE_LOG(LogGenPerformance, Warning, TEXT("  Parsers disagree: %d vs %d characters of content"), Legacy.BodyBytes, Direct.BodyBytes);
+		}
+	}
+
+	void RunTokenizerBenchmark(const TArray<FString>& Args)
+	{
+		const int32 TextChars = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10;
+
+		// Dialogue, some code-like text, numbers and the odd non ASCII word
+		const FString Filler = TEXT("The innkeeper leans over the counter: \"You've travelled far, haven't you?\"\n")
+			TEXT("QuestLog.Add({id: 1042, reward: 250.75, tags: [\"main\", \"caf\u00e9\"]});\n\n    ");
+		FString Text;
+		Text.Reserve(TextChars + Filler.Len());
+		while (Text.Len() < TextChars)
+		{
+			Text += Filler;
+		}
+		const FTCHARToUTF8 Converter(*Text, Text.Len());
+		const TConstArrayView<uint8> Utf8(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+
+		for (const EGenTokenizerEncoding Encoding : {EGenTokenizerEncoding::CL100K, EGenTokenizerEncoding::O200K})
+		{
+			const FGenTokenizer* Tokenizer = FGenTokenizer::Get(Encoding);
+			if (!Tokenizer)
+			{
+				UE_LOG(LogGenPerformance, Display, TEXT("Tokenizer benchmark: %s vocab not installed, skipped"), FGenTokenizer::GetEncodingName(Encoding));
+				continue;
+			}
+
+			const FBenchResult Result = Measure(*FString::Printf(TEXT("Tokenizer %s"), FGenTokenizer::GetEncodingName(Encoding)), Iterations, [Tokenizer, Utf8]() { return Tokenizer->CountTokensUtf8(Utf8); });
+			const double MegabytesPerSecond = Utf8.Num() / Result.MicrosecondsPerIteration;
+			UE_LOG(LogGenPerformance, Display, TEXT("Tokenizer benchmark %s: %d bytes -> %d tokens, %.1f ms, %.1f MB/s"),
+			       FGenTokenizer::GetEncodingName(Encoding), Utf8.Num(), Result.BodyBytes, Result.MicrosecondsPerIteration / 1000.0,
+			       MegabytesPerSecond);
+		}
+	}
+
+	FAutoConsoleCommand GenAIBenchTokenizerCommand(
+		TEXT("GenAI.Bench.Tokenizer"),
+		TEXT("Measures FGenTokenizer throughput for every installed vocab. Args: [TextChars=1000000] [Iterations=10]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunTokenizerBenchmark));
+
+	FAutoConsoleCommand GenAIBenchParseCommand(
+		TEXT("GenAI.Bench.Parse"),
+		TEXT("Compares response parsing through FString + FJsonObject against FGenJsonPullReader. Args: [ResponseChars=16000] [Iterations=200]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunParseBenchmark));
+
+	FAutoConsoleCommand GenAIBenchPayloadCommand(
+		TEXT("GenAI.Bench.Payload"),
+		TEXT("Compares request body construction through FJsonObject against FGenJsonPayloadWriter. Args: [Messages=64] [Iterations=200] [CharsPerMessage=400]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunPayloadBenchmark));
+}
+
+#endif // !UE_BUILD_SHIPPING
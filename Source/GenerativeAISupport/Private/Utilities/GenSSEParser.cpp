@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Utilities/GenSSEParser.h"
+
+#include "Containers/StringConv.h"
+
+void FGenSSEParser::Feed(const uint8* Data, int64 Num, FOnEvent OnEvent)
+{
+	if (!Data || Num <= 0)
+	{
+		return;
+	}
+
+	int64 LineStart = 0;
+	int64 Index = 0;
+
+	// A "\r\n" pair may have been split across two chunks
+	if (bSkipLeadingLineFeed)
+	{
+		bSkipLeadingLineFeed = false;
+		if (Data[0] == '\n')
+		{
+			LineStart = Index = 1;
+		}
+	}
+
+	for (; Index < Num; ++Index)
+	{
+		const uint8 Byte = Data[Index];
+		if (Byte != '\n' && Byte != '\r')
+		{
+			continue;
+		}
+
+		const uint8* LineData = Data + LineStart;
+		int32 LineLength = static_cast<int32>(Index - LineStart);
+		if (PendingLine.Num() > 0)
+		{
+			PendingLine.Append(LineData, LineLength);
+			ProcessLine(PendingLine.GetData(), PendingLine.Num(), OnEvent);
+			PendingLine.Reset();
+		}
+		else
+		{
+			ProcessLine(LineData, LineLength, OnEvent);
+		}
+
+		if (Byte == '\r')
+		{
+			if (Index + 1 < Num)
+			{
+				if (Data[Index + 1] == '\n')
+				{
+					++Index;
+				}
+			}
+			else
+			{
+				bSkipLeadingLineFeed = true;
+			}
+		}
+		LineStart = Index + 1;
+	}
+
+	if (LineStart < Num)
+	{
+		PendingLine.Append(Data + LineStart, static_cast<int32>(Num - LineStart));
+	}
+}
+
+void FGenSSEParser::Flush(FOnEvent OnEvent)
+{
+	if (PendingLine.Num() > 0)
+	{
+		ProcessLine(PendingLine.GetData(), PendingLine.Num(), OnEvent);
+		PendingLine.Reset();
+	}
+	DispatchEvent(OnEvent);
+}
+
+void FGenSSEParser::Reset()
+{
+	PendingLine.Reset();
+	CurrentEvent = FGenSSEEvent();
+	bHasData = false;
+	bReceivedEvents = false;
+	bSkipLeadingLineFeed = false;
+}
+
+void FGenSSEParser::ProcessLine(const uint8* Line, int32 Length, FOnEvent OnEvent)
+{
+	// Blank line terminates the current event
+	if (Length == 0)
+	{
+		DispatchEvent(OnEvent);
+		return;
+	}
+
+	// Comment lines (used by some providers as keep-alives)
+	if (Line[0] == ':')
+	{
+		return;
+	}
+
+	int32 Colon = 0;
+	while (Colon < Length && Line[Colon] != ':')
+	{
+		++Colon;
+	}
+
+	const FAnsiStringView Field(reinterpret_cast<const ANSICHAR*>(Line), Colon);
+
+	int32 ValueStart = FMath::Min(Colon + 1, Length);
+	if (ValueStart < Length && Line[ValueStart] == ' ')
+	{
+		++ValueStart;
+	}
+
+	if (Field.Equals("data", ESearchCase::CaseSensitive))
+	{
+		if (bHasData)
+		{
+			CurrentEvent.Data.Add('\n');
+		}
+		CurrentEvent.Data.Append(Line + ValueStart, Length - ValueStart);
+		bHasData = true;
+	}
+	else if (Field.Equals("event", ESearchCase::CaseSensitive))
+	{
+		const FUTF8ToTCHAR ValueConv(reinterpret_cast<const ANSICHAR*>(Line + ValueStart), Length - ValueStart);
+		CurrentEvent.Event = FString(ValueConv.Length(), ValueConv.Get());
+	}
+	// "id" and "retry" are not used by any of the providers, ignore them like unknown fields
+}
+
+void FGenSSEParser::DispatchEvent(FOnEvent OnEvent)
+{
+	if (bHasData)
+	{
+		bReceivedEvents = true;
+		OnEvent(CurrentEvent);
+	}
+	// Keep the data buffer's allocation for the next event
+	CurrentEvent.Event.Reset();
+	CurrentEvent.Data.Reset();
+	bHasData = false;
+}
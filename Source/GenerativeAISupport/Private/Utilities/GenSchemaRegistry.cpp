@@ -0,0 +1,487 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Utilities/GenSchemaRegistry.h"
+
+#include "Dom/JsonObject.h"
+#include "JsonObjectConverter.h"
+#include "Misc/ScopeRWLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenStructDecoder.h"
+#include "Utilities/GenTrace.h"
+
+namespace
+{
+	// Ad hoc schema texts kept at most, generated schemas must not grow the cache forever
+	constexpr int32 MaxCachedSchemaTexts = 256;
+
+	bool IsKnownType(const FString& Type)
+	{
+		return Type == TEXT("object") || Type == TEXT("array") || Type == TEXT("string") || Type == TEXT("number")
+			|| Type == TEXT("integer") || Type == TEXT("boolean") || Type == TEXT("null");
+	}
+
+	bool ValidateNode(const FJsonObject& Node, const FString& Path, FString& OutError);
+
+	bool ValidateChild(const TSharedPtr<FJsonValue>& Value, const FString& Path, FString& OutError)
+	{
+		const TSharedPtr<FJsonObject>* Child = nullptr;
+		if (!Value.IsValid() || !Value->TryGetObject(Child))
+		{
+			OutError = FString::Printf(TEXT("%s is not a schema object"), *Path);
+			return false;
+		}
+		return ValidateNode(**Child, Path, OutError);
+	}
+
+	// Catches what the provider would reject with a 400 anyway, before the request goes out
+	bool ValidateNode(const FJsonObject& Node, const FString& Path, FString& OutError)
+	{
+		if (const TSharedPtr<FJsonValue> Type = Node.TryGetField(TEXT("type")))
+		{
+			// A single type or a list of them, ["string", "null"] is how optional fields are spelled
+			TArray<TSharedPtr<FJsonValue>> Types;
+			if (Type->Type == EJson::Array)
+			{
+				Types = Type->AsArray();
+			}
+			else
+			{
+				Types.Add(Type);
+			}
+			for (const TSharedPtr<FJsonValue>& Entry : Types)
+			{
+				if (Entry->Type != EJson::String || !IsKnownType(Entry->AsString()))
+				{
+					OutError = FString::Printf(TEXT("%s has an unknown type"), *Path);
+					return false;
+				}
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* Properties = nullptr;
+		if (Node.HasField(TEXT("properties")))
+		{
+			if (!Node.TryGetObjectField(TEXT("properties"), Properties))
+			{
+				OutError = FString::Printf(TEXT("%s.properties is not an object"), *Path);
+				return false;
+			}
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*Properties)->Values)
+			{
+				if (!ValidateChild(Property.Value, Path + TEXT(".properties.") + Property.Key, OutError))
+				{
+					return false;
+				}
+			}
+		}
+
+		if (Node.HasField(TEXT("required")))
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Required = nullptr;
+			if (!Node.TryGetArrayField(TEXT("required"), Required))
+			{
+				OutError = FString::Printf(TEXT("%s.required is not an array"), *Path);
+				return false;
+			}
+			for (const TSharedPtr<FJsonValue>& Name : *Required)
+			{
+				if (Name->Type != EJson::String)
+				{
+					OutError = FString::Printf(TEXT("%s.required holds something other than a property name"), *Path);
+					return false;
+				}
+				if (!Properties || !(*Properties)->HasField(Name->AsString()))
+				{
+					// Providers disagree on whether this is an error, so it is only pointed out
+					UE_LOG(LogGenAI, Warning, TEXT("Schema: %s requires \"%s\", which it does not define"), *Path, *Name->AsString());
+				}
+			}
+		}
+
+		if (Node.HasField(TEXT("items")) && !ValidateChild(Node.TryGetField(TEXT("items")), Path + TEXT(".items"), OutError))
+		{
+			return false;
+		}
+
+		for (const TCHAR* Combinator : {TEXT("anyOf"), TEXT("oneOf"), TEXT("allOf")})
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Alternatives = nullptr;
+			if (Node.TryGetArrayField(Combinator, Alternatives))
+			{
+				for (int32 Index = 0; Index < Alternatives->Num(); ++Index)
+				{
+					if (!ValidateChild((*Alternatives)[Index], FString::Printf(TEXT("%s.%s[%d]"), *Path, Combinator, Index), OutError))
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		for (const TCHAR* Definitions : {TEXT("$defs"), TEXT("definitions")})
+		{
+			const TSharedPtr<FJsonObject>* Defined = nullptr;
+			if (Node.TryGetObjectField(Definitions, Defined))
+			{
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Definition : (*Defined)->Values)
+				{
+					if (!ValidateChild(Definition.Value, FString::Printf(TEXT("%s.%s.%s"), *Path, Definitions, *Definition.Key), OutError))
+					{
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	// Structs being expanded, and the ones found to contain themselves, which are written once under $defs and referenced
+	struct FStructSchemaContext
+	{
+		const UStruct* Root = nullptr;
+		TArray<const UStruct*> Stack;
+		TSet<const UStruct*> Recursive;
+		TSharedRef<FJsonObject> Definitions = MakeShared<FJsonObject>();
+	};
+
+	TSharedPtr<FJsonObject> MakeStructSchema(const UStruct* Struct, FStructSchemaContext& Context);
+
+	TSharedPtr<FJsonObject> MakeEnumSchema(const UEnum* Enum)
+	{
+		const TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("type"), TEXT("string"));
+		TArray<TSharedPtr<FJsonValue>> Values;
+		// The last entry is the generated _MAX
+		for (int32 Index = 0; Index < Enum->NumEnums() - 1; ++Index)
+		{
+			Values.Add(MakeShared<FJsonValueString>(Enum->GetNameStringByIndex(Index)));
+		}
+		Schema->SetArrayField(TEXT("enum"), Values);
+		return Schema;
+	}
+
+	TSharedPtr<FJsonObject> MakePropertySchema(const FProperty* Property, FStructSchemaContext& Context)
+	{
+		const auto MakeTyped = [](const TCHAR* Type)
+		{
+			const TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
+			Schema->SetStringField(TEXT("type"), Type);
+			return Schema;
+		};
+
+		if (Property->IsA<FBoolProperty>())
+		{
+			return MakeTyped(TEXT("boolean"));
+		}
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			return MakeEnumSchema(EnumProperty->GetEnum());
+		}
+		if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+			{
+				return MakeEnumSchema(Enum);
+			}
+			return MakeTyped(NumericProperty->IsInteger() ? TEXT("integer") : TEXT("number"));
+		}
+		if (Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FTextProperty>())
+		{
+			return MakeTyped(TEXT("string"));
+		}
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			return MakeStructSchema(StructProperty->Struct, Context);
+		}
+
+		const FProperty* ElementProperty = nullptr;
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			ElementProperty = ArrayProperty->Inner;
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			ElementProperty = SetProperty->ElementProp;
+		}
+		if (ElementProperty)
+		{
+			const TSharedPtr<FJsonObject> Items = MakePropertySchema(ElementProperty, Context);
+			if (!Items.IsValid())
+			{
+				return nullptr;
+			}
+			const TSharedRef<FJsonObject> Schema = MakeTyped(TEXT("array"));
+			Schema->SetObjectField(TEXT("items"), Items);
+			return Schema;
+		}
+
+		// Maps, object references and delegates have no strict schema
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> MakeStructRef(const UStruct* Struct, const FStructSchemaContext& Context)
+	{
+		const TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("$ref"), Struct == Context.Root ? FString(TEXT("#")) : TEXT("#/$defs/") + Struct->GetName());
+		return Schema;
+	}
+
+	// Strict mode shape, every property required and nothing else allowed
+	TSharedPtr<FJsonObject> MakeStructSchema(const UStruct* Struct, FStructSchemaContext& Context)
+	{
+		// Inlining a struct that holds an array of itself would never end
+		if (Context.Stack.Contains(Struct))
+		{
+			Context.Recursive.Add(Struct);
+			return MakeStructRef(Struct, Context);
+		}
+		if (Context.Definitions->HasField(Struct->GetName()))
+		{
+			return MakeStructRef(Struct, Context);
+		}
+		Context.Stack.Push(Struct);
+
+		const TSharedRef<FJsonObject> Properties = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> Required;
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+			const TSharedPtr<FJsonObject> PropertySchema = MakePropertySchema(Property, Context);
+			if (!PropertySchema.IsValid())
+			{
+				continue;
+			}
+			// Named the way FJsonObjectConverter names them, so its output and the model's agree
+			const FString Name = FJsonObjectConverter::StandardizeCase(Property->GetAuthoredName());
+			Properties->SetObjectField(Name, PropertySchema);
+			Required.Add(MakeShared<FJsonValueString>(Name));
+		}
+
+		const TSharedRef<FJsonObject> Schema = MakeShared<FJsonObject>();
+		Schema->SetStringField(TEXT("type"), TEXT("object"));
+		Schema->SetObjectField(TEXT("properties"), Properties);
+		Schema->SetArrayField(TEXT("required"), Required);
+		Schema->SetBoolField(TEXT("additionalProperties"), false);
+
+		Context.Stack.Pop();
+		if (Struct != Context.Root && Context.Recursive.Contains(Struct))
+		{
+			Context.Definitions->SetObjectField(Struct->GetName(), Schema);
+			return MakeStructRef(Struct, Context);
+		}
+		return Schema;
+	}
+}
+
+FGenSchemaRegistry& FGenSchemaRegistry::Get()
+{
+	static FGenSchemaRegistry Registry;
+	return Registry;
+}
+
+TSharedPtr<FGenCompiledSchema> FGenSchemaRegistry::Compile(FName Name, const FString& SchemaJson, FString& OutError)
+{
+	GENAI_TRACE_SCOPE("GenAI::CompileSchema");
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(SchemaJson);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+	{
+		OutError = FString::Printf(TEXT("Failed to parse schema JSON: %s"), *SchemaJson);
+		return nullptr;
+	}
+
+	// Structured outputs only accept an object at the root
+	FString RootType;
+	if (!Root->TryGetStringField(TEXT("type"), RootType) || RootType != TEXT("object"))
+	{
+		OutError = TEXT("Schema root must be of type \"object\"");
+		return nullptr;
+	}
+	if (!ValidateNode(*Root, TEXT("schema"), OutError))
+	{
+		return nullptr;
+	}
+
+	FString Condensed;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Condensed);
+	FJsonSerializer::Serialize(Root.ToSharedRef(), Writer);
+
+	const TSharedRef<FGenCompiledSchema> Compiled = MakeShared<FGenCompiledSchema>();
+	Compiled->Name = Name;
+	const FTCHARToUTF8 Utf8(*Condensed, Condensed.Len());
+	Compiled->Utf8Json.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	return Compiled;
+}
+
+TSharedPtr<const FGenCompiledSchema> FGenSchemaRegistry::Register(FName Name, const FString& SchemaJson, FString* OutError)
+{
+	FString Error;
+	const TSharedPtr<const FGenCompiledSchema> Compiled = Compile(Name, SchemaJson, Error);
+	if (!Compiled.IsValid())
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Schema %s not registered: %s"), *Name.ToString(), *Error);
+		if (OutError)
+		{
+			*OutError = MoveTemp(Error);
+		}
+		return nullptr;
+	}
+
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+	ByName.Add(Name, Compiled.ToSharedRef());
+	return Compiled;
+}
+
+TSharedPtr<const FGenCompiledSchema> FGenSchemaRegistry::RegisterStruct(const UScriptStruct* Struct)
+{
+	if (!Struct)
+	{
+		return nullptr;
+	}
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+		if (const TSharedRef<const FGenCompiledSchema>* Found = ByStruct.Find(Struct))
+		{
+			return *Found;
+		}
+	}
+
+	FString Error;
+	const TSharedPtr<FGenCompiledSchema> Compiled = Compile(Struct->GetFName(), MakeSchemaFromStruct(Struct), Error);
+	if (!Compiled.IsValid())
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("No schema for %s: %s"), *Struct->GetName(), *Error);
+		return nullptr;
+	}
+	Compiled->bStrict = true;
+	Compiled->Struct = Struct;
+
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+	ByStruct.Add(Struct, Compiled.ToSharedRef());
+	ByName.Add(Struct->GetFName(), Compiled.ToSharedRef());
+	return Compiled;
+}
+
+TSharedPtr<const FGenCompiledSchema> FGenSchemaRegistry::Find(FName Name) const
+{
+	FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+	const TSharedRef<const FGenCompiledSchema>* Found = ByName.Find(Name);
+	return Found ? TSharedPtr<const FGenCompiledSchema>(*Found) : nullptr;
+}
+
+TSharedPtr<const FGenCompiledSchema> FGenSchemaRegistry::FindOrAddJson(const FString& SchemaJson, FString& OutError)
+{
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+		if (const TSharedRef<const FGenCompiledSchema>* Found = ByJson.Find(SchemaJson))
+		{
+			return *Found;
+		}
+	}
+
+	const TSharedPtr<const FGenCompiledSchema> Compiled = Compile(NAME_None, SchemaJson, OutError);
+	if (!Compiled.IsValid())
+	{
+		return nullptr;
+	}
+
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+	if (ByJson.Num() >= MaxCachedSchemaTexts)
+	{
+		UE_LOG(LogGenAIVerbose, Log, TEXT("Schema cache full, register schemas that are sent often by name"));
+		ByJson.Reset();
+	}
+	ByJson.Add(SchemaJson, Compiled.ToSharedRef());
+	return Compiled;
+}
+
+TSharedPtr<const FGenCompiledSchema> FGenSchemaRegistry::Resolve(const UScriptStruct* Struct, FName Name, const FString& SchemaJson, FString& OutError)
+{
+	CompilePendingStructs();
+	if (Struct)
+	{
+		const TSharedPtr<const FGenCompiledSchema> Compiled = RegisterStruct(Struct);
+		if (!Compiled.IsValid())
+		{
+			OutError = FString::Printf(TEXT("No schema could be derived from %s"), *Struct->GetName());
+		}
+		return Compiled;
+	}
+	if (!Name.IsNone())
+	{
+		const TSharedPtr<const FGenCompiledSchema> Compiled = Find(Name);
+		if (!Compiled.IsValid())
+		{
+			OutError = FString::Printf(TEXT("No schema registered as %s"), *Name.ToString());
+		}
+		return Compiled;
+	}
+	return FindOrAddJson(SchemaJson, OutError);
+}
+
+FString FGenSchemaRegistry::MakeSchemaFromStruct(const UScriptStruct* Struct)
+{
+	if (!Struct)
+	{
+		return FString();
+	}
+
+	FStructSchemaContext Context;
+	Context.Root = Struct;
+	const TSharedPtr<FJsonObject> Schema = MakeStructSchema(Struct, Context);
+	if (Context.Definitions->Values.Num() > 0)
+	{
+		Schema->SetObjectField(TEXT("$defs"), Context.Definitions);
+	}
+
+	FString SchemaJson;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&SchemaJson);
+	FJsonSerializer::Serialize(Schema.ToSharedRef(), Writer);
+	return SchemaJson;
+}
+
+void FGenSchemaRegistry::AddPendingStruct(UScriptStruct* (*GetStruct)())
+{
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+	PendingStructs.Add(GetStruct);
+}
+
+void FGenSchemaRegistry::CompilePendingStructs()
+{
+	TArray<UScriptStruct* (*)()> Pending;
+	{
+		// Checked without the write lock first, this runs before every structured request
+		FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+		if (PendingStructs.Num() == 0)
+		{
+			return;
+		}
+	}
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_Write);
+		Pending = MoveTemp(PendingStructs);
+	}
+	for (UScriptStruct* (*GetStruct)() : Pending)
+	{
+		// Responses to these schemas are usually decoded back into the struct
+		UScriptStruct* Struct = GetStruct();
+		RegisterStruct(Struct);
+		FGenStructDecoder::Prepare(Struct);
+	}
+}
+
+bool UGenSchemaLibrary::RegisterSchema(FName Name, const FString& SchemaJson)
+{
+	return FGenSchemaRegistry::Get().Register(Name, SchemaJson).IsValid();
+}
+
+FString UGenSchemaLibrary::MakeSchemaFromStruct(const UScriptStruct* Struct)
+{
+	return FGenSchemaRegistry::MakeSchemaFromStruct(Struct);
+}
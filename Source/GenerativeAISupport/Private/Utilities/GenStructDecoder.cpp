@@ -0,0 +1,596 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Utilities/GenStructDecoder.h"
+
+#include "Containers/StringConv.h"
+#include "JsonObjectConverter.h"
+#include "Misc/ScopeRWLock.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenJsonPullReader.h"
+#include "Utilities/GenTrace.h"
+
+namespace
+{
+	// Objects and arrays nested deeper than this are rejected rather than recursed into
+	constexpr int32 MaxNestingDepth = 64;
+
+	struct FStructMap;
+	struct FFieldDecoder;
+
+	struct FDecodeContext
+	{
+		explicit FDecodeContext(TConstArrayView<uint8> Json)
+			: Reader(Json)
+		{
+		}
+
+		FGenJsonPullReader Reader;
+		FString Error;
+		int32 Depth = 0;
+	};
+
+	// Decodes the value the reader is on into Value, the memory of Decoder's property
+	using FDecodeFunction = bool (*)(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value);
+
+	struct FFieldDecoder
+	{
+		FDecodeFunction Function = nullptr;
+
+		// Property the value is written through, the underlying integer property for enums
+		const FProperty* Property = nullptr;
+
+		const UEnum* Enum = nullptr;
+
+		// Map of a nested struct, owned by the cache
+		const FStructMap* Struct = nullptr;
+
+		// Elements of an array or set
+		TUniquePtr<FFieldDecoder> Element;
+	};
+
+	struct FStructField
+	{
+		// Standardized name as UTF-8, compared to the raw key bytes
+		TArray<ANSICHAR> Key;
+		int32 Offset = 0;
+		FFieldDecoder Decoder;
+	};
+
+	struct FStructMap
+	{
+		TArray<FStructField> Fields;
+	};
+
+	struct FStructMapCache
+	{
+		FRWLock Lock;
+		TMap<TWeakObjectPtr<const UScriptStruct>, TUniquePtr<FStructMap>> Maps;
+	};
+
+	FStructMapCache& GetCache()
+	{
+		static FStructMapCache Cache;
+		return Cache;
+	}
+
+	bool Fail(FDecodeContext& Context, FString Error)
+	{
+		if (Context.Error.IsEmpty())
+		{
+			Context.Error = MoveTemp(Error);
+		}
+		return false;
+	}
+
+	bool FailMismatch(FDecodeContext& Context, const FFieldDecoder& Decoder, const TCHAR* Expected)
+	{
+		if (Context.Reader.GetToken() == EGenJsonToken::Error)
+		{
+			return Fail(Context, TEXT("Malformed JSON"));
+		}
+		return Fail(Context, FString::Printf(TEXT("Expected %s for %s"), Expected, *Decoder.Property->GetAuthoredName()));
+	}
+
+	// Numbers are handed out as raw text, copied so the C parsers get their terminator
+	bool ReadNumberText(FDecodeContext& Context, const FFieldDecoder& Decoder, ANSICHAR (&Buffer)[64])
+	{
+		if (Context.Reader.GetToken() != EGenJsonToken::Number)
+		{
+			return FailMismatch(Context, Decoder, TEXT("a number"));
+		}
+		const FAnsiStringView Raw = Context.Reader.GetRawValue();
+		if (Raw.Len() >= UE_ARRAY_COUNT(Buffer))
+		{
+			return Fail(Context, FString::Printf(TEXT("Number too long for %s"), *Decoder.Property->GetAuthoredName()));
+		}
+		FMemory::Memcpy(Buffer, Raw.GetData(), Raw.Len());
+		Buffer[Raw.Len()] = '\0';
+		return true;
+	}
+
+	bool IsIntegerText(const ANSICHAR* Text)
+	{
+		for (; *Text; ++Text)
+		{
+			if (*Text == '.' || *Text == 'e' || *Text == 'E')
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool ReadInteger(FDecodeContext& Context, const FFieldDecoder& Decoder, int64& OutValue)
+	{
+		ANSICHAR Buffer[64];
+		if (!ReadNumberText(Context, Decoder, Buffer))
+		{
+			return false;
+		}
+		// Models sometimes write whole numbers as 3.0
+		OutValue = IsIntegerText(Buffer) ? FCStringAnsi::Atoi64(Buffer) : static_cast<int64>(FCStringAnsi::Atod(Buffer));
+		return true;
+	}
+
+	bool ReadFloat(FDecodeContext& Context, const FFieldDecoder& Decoder, double& OutValue)
+	{
+		ANSICHAR Buffer[64];
+		if (!ReadNumberText(Context, Decoder, Buffer))
+		{
+			return false;
+		}
+		OutValue = FCStringAnsi::Atod(Buffer);
+		return true;
+	}
+
+	template <typename T>
+	bool DecodeInteger(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		int64 Number;
+		if (!ReadInteger(Context, Decoder, Number))
+		{
+			return false;
+		}
+		*static_cast<T*>(Value) = static_cast<T>(Number);
+		return true;
+	}
+
+	template <typename T>
+	bool DecodeFloat(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		double Number;
+		if (!ReadFloat(Context, Decoder, Number))
+		{
+			return false;
+		}
+		*static_cast<T*>(Value) = static_cast<T>(Number);
+		return true;
+	}
+
+	// Integer types without a dedicated thunk
+	bool DecodeNumeric(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		const FNumericProperty* Property = static_cast<const FNumericProperty*>(Decoder.Property);
+		if (Property->IsInteger())
+		{
+			int64 Number;
+			if (!ReadInteger(Context, Decoder, Number))
+			{
+				return false;
+			}
+			Property->SetIntPropertyValue(Value, Number);
+			return true;
+		}
+
+		double Number;
+		if (!ReadFloat(Context, Decoder, Number))
+		{
+			return false;
+		}
+		Property->SetFloatingPointPropertyValue(Value, Number);
+		return true;
+	}
+
+	// By name, as in the schema FGenSchemaRegistry derives, or by value
+	bool DecodeEnum(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		const FNumericProperty* Property = static_cast<const FNumericProperty*>(Decoder.Property);
+		if (Context.Reader.GetToken() == EGenJsonToken::Number)
+		{
+			int64 Number;
+			if (!ReadInteger(Context, Decoder, Number))
+			{
+				return false;
+			}
+			Property->SetIntPropertyValue(Value, Number);
+			return true;
+		}
+		if (Context.Reader.GetToken() != EGenJsonToken::String)
+		{
+			return FailMismatch(Context, Decoder, TEXT("an enum name"));
+		}
+
+		const FString Name = Context.Reader.GetString();
+		const int64 EnumValue = Decoder.Enum->GetValueByNameString(Name);
+		if (EnumValue == INDEX_NONE)
+		{
+			return Fail(Context, FString::Printf(TEXT("%s is not a value of %s"), *Name, *Decoder.Enum->GetName()));
+		}
+		Property->SetIntPropertyValue(Value, EnumValue);
+		return true;
+	}
+
+	bool DecodeBool(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		const EGenJsonToken Token = Context.Reader.GetToken();
+		if (Token != EGenJsonToken::True && Token != EGenJsonToken::False)
+		{
+			return FailMismatch(Context, Decoder, TEXT("a boolean"));
+		}
+		// Goes through the property for bitfields
+		static_cast<const FBoolProperty*>(Decoder.Property)->SetPropertyValue(Value, Token == EGenJsonToken::True);
+		return true;
+	}
+
+	bool DecodeString(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		if (Context.Reader.GetToken() != EGenJsonToken::String)
+		{
+			return FailMismatch(Context, Decoder, TEXT("a string"));
+		}
+		*static_cast<FString*>(Value) = Context.Reader.GetString();
+		return true;
+	}
+
+	bool DecodeName(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		if (Context.Reader.GetToken() != EGenJsonToken::String)
+		{
+			return FailMismatch(Context, Decoder, TEXT("a string"));
+		}
+		*static_cast<FName*>(Value) = FName(Context.Reader.GetString());
+		return true;
+	}
+
+	bool DecodeText(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		if (Context.Reader.GetToken() != EGenJsonToken::String)
+		{
+			return FailMismatch(Context, Decoder, TEXT("a string"));
+		}
+		*static_cast<FText*>(Value) = FText::FromString(Context.Reader.GetString());
+		return true;
+	}
+
+	bool EnterContainer(FDecodeContext& Context)
+	{
+		if (++Context.Depth > MaxNestingDepth)
+		{
+			return Fail(Context, FString::Printf(TEXT("JSON nests deeper than %d levels"), MaxNestingDepth));
+		}
+		return true;
+	}
+
+	// Properties are usually written in declaration order, so the field after the previous match is tried first
+	const FStructField* FindField(const FStructMap& Map, FAnsiStringView Key, int32& InOutHint)
+	{
+		const int32 NumFields = Map.Fields.Num();
+		for (int32 Offset = 0; Offset < NumFields; ++Offset)
+		{
+			const int32 Index = (InOutHint + Offset) % NumFields;
+			const FStructField& Field = Map.Fields[Index];
+			if (Field.Key.Num() == Key.Len() && FCStringAnsi::Strnicmp(Field.Key.GetData(), Key.GetData(), Key.Len()) == 0)
+			{
+				InOutHint = Index + 1;
+				return &Field;
+			}
+		}
+		return nullptr;
+	}
+
+	bool DecodeObject(FDecodeContext& Context, const FStructMap& Map, void* Data)
+	{
+		if (!EnterContainer(Context))
+		{
+			return false;
+		}
+
+		int32 Hint = 0;
+		while (true)
+		{
+			const EGenJsonToken Token = Context.Reader.Next();
+			if (Token == EGenJsonToken::ObjectEnd)
+			{
+				break;
+			}
+			if (Token != EGenJsonToken::Key)
+			{
+				return Fail(Context, TEXT("Malformed JSON"));
+			}
+
+			const FStructField* Field = FindField(Map, Context.Reader.GetRawValue(), Hint);
+			if (!Field)
+			{
+				if (!Context.Reader.SkipNextValue())
+				{
+					return Fail(Context, TEXT("Malformed JSON"));
+				}
+				continue;
+			}
+
+			// Null keeps the property's value, strict schemas never produce it
+			if (Context.Reader.Next() == EGenJsonToken::Null)
+			{
+				continue;
+			}
+			if (!Field->Decoder.Function(Context, Field->Decoder, static_cast<uint8*>(Data) + Field->Offset))
+			{
+				return false;
+			}
+		}
+
+		--Context.Depth;
+		return true;
+	}
+
+	bool DecodeStruct(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		if (Context.Reader.GetToken() != EGenJsonToken::ObjectStart)
+		{
+			return FailMismatch(Context, Decoder, TEXT("an object"));
+		}
+		return DecodeObject(Context, *Decoder.Struct, Value);
+	}
+
+	bool DecodeArray(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		if (Context.Reader.GetToken() != EGenJsonToken::ArrayStart)
+		{
+			return FailMismatch(Context, Decoder, TEXT("an array"));
+		}
+		if (!EnterContainer(Context))
+		{
+			return false;
+		}
+
+		FScriptArrayHelper Helper(static_cast<const FArrayProperty*>(Decoder.Property), Value);
+		Helper.EmptyValues();
+		const FFieldDecoder& Element = *Decoder.Element;
+		while (true)
+		{
+			const EGenJsonToken Token = Context.Reader.Next();
+			if (Token == EGenJsonToken::ArrayEnd)
+			{
+				break;
+			}
+			const int32 Index = Helper.AddValue();
+			if (Token != EGenJsonToken::Null && !Element.Function(Context, Element, Helper.GetRawPtr(Index)))
+			{
+				return false;
+			}
+		}
+
+		--Context.Depth;
+		return true;
+	}
+
+	bool DecodeSet(FDecodeContext& Context, const FFieldDecoder& Decoder, void* Value)
+	{
+		if (Context.Reader.GetToken() != EGenJsonToken::ArrayStart)
+		{
+			return FailMismatch(Context, Decoder, TEXT("an array"));
+		}
+		if (!EnterContainer(Context))
+		{
+			return false;
+		}
+
+		const FSetProperty* SetProperty = static_cast<const FSetProperty*>(Decoder.Property);
+		FScriptSetHelper Helper(SetProperty, Value);
+		Helper.EmptyElements();
+
+		// Elements are decoded into a scratch value first, AddElement then drops duplicates
+		const FFieldDecoder& Element = *Decoder.Element;
+		const FProperty* ElementProperty = SetProperty->ElementProp;
+		void* Scratch = FMemory::Malloc(ElementProperty->GetSize(), ElementProperty->GetMinAlignment());
+		ElementProperty->InitializeValue(Scratch);
+
+		bool bSuccess = true;
+		while (bSuccess)
+		{
+			const EGenJsonToken Token = Context.Reader.Next();
+			if (Token == EGenJsonToken::ArrayEnd)
+			{
+				break;
+			}
+			ElementProperty->ClearValue(Scratch);
+			bSuccess = Token == EGenJsonToken::Null || Element.Function(Context, Element, Scratch);
+			if (bSuccess)
+			{
+				Helper.AddElement(Scratch);
+			}
+		}
+
+		ElementProperty->DestroyValue(Scratch);
+		FMemory::Free(Scratch);
+		--Context.Depth;
+		return bSuccess;
+	}
+
+	const FStructMap& FindOrBuildLocked(FStructMapCache& Cache, const UScriptStruct* Struct);
+
+	bool MakeDecoder(FStructMapCache& Cache, const FProperty* Property, FFieldDecoder& Out)
+	{
+		Out.Property = Property;
+
+		if (Property->IsA<FBoolProperty>())
+		{
+			Out.Function = &DecodeBool;
+		}
+		else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			Out.Function = &DecodeEnum;
+			Out.Property = EnumProperty->GetUnderlyingProperty();
+			Out.Enum = EnumProperty->GetEnum();
+		}
+		else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+		{
+			if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+			{
+				Out.Function = &DecodeEnum;
+				Out.Enum = Enum;
+			}
+			else if (Property->IsA<FIntProperty>())
+			{
+				Out.Function = &DecodeInteger<int32>;
+			}
+			else if (Property->IsA<FInt64Property>())
+			{
+				Out.Function = &DecodeInteger<int64>;
+			}
+			else if (Property->IsA<FByteProperty>())
+			{
+				Out.Function = &DecodeInteger<uint8>;
+			}
+			else if (Property->IsA<FFloatProperty>())
+			{
+				Out.Function = &DecodeFloat<float>;
+			}
+			else if (Property->IsA<FDoubleProperty>())
+			{
+				Out.Function = &DecodeFloat<double>;
+			}
+			else
+			{
+				Out.Function = &DecodeNumeric;
+			}
+		}
+		else if (Property->IsA<FStrProperty>())
+		{
+			Out.Function = &DecodeString;
+		}
+		else if (Property->IsA<FNameProperty>())
+		{
+			Out.Function = &DecodeName;
+		}
+		else if (Property->IsA<FTextProperty>())
+		{
+			Out.Function = &DecodeText;
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			Out.Function = &DecodeStruct;
+			Out.Struct = &FindOrBuildLocked(Cache, StructProperty->Struct);
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			Out.Function = &DecodeArray;
+			Out.Element = MakeUnique<FFieldDecoder>();
+			return MakeDecoder(Cache, ArrayProperty->Inner, *Out.Element);
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			Out.Function = &DecodeSet;
+			Out.Element = MakeUnique<FFieldDecoder>();
+			return MakeDecoder(Cache, SetProperty->ElementProp, *Out.Element);
+		}
+		else
+		{
+			// Maps, object references and delegates have no schema either, their keys are skipped
+			return false;
+		}
+		return true;
+	}
+
+	const FStructMap& FindOrBuildLocked(FStructMapCache& Cache, const UScriptStruct* Struct)
+	{
+		if (const TUniquePtr<FStructMap>* Found = Cache.Maps.Find(Struct))
+		{
+			return **Found;
+		}
+
+		// Added before its fields are built, so a struct holding an array of itself finds its own map
+		FStructMap& Map = *Cache.Maps.Add(Struct, MakeUnique<FStructMap>());
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+			FFieldDecoder Decoder;
+			if (!MakeDecoder(Cache, Property, Decoder))
+			{
+				continue;
+			}
+
+			// Named the way FGenSchemaRegistry names them in the schema
+			const FString Name = FJsonObjectConverter::StandardizeCase(Property->GetAuthoredName());
+			const FTCHARToUTF8 Utf8(*Name, Name.Len());
+
+			FStructField& Field = Map.Fields.AddDefaulted_GetRef();
+			Field.Key.Append(Utf8.Get(), Utf8.Length());
+			Field.Offset = Property->GetOffset_ForInternal();
+			Field.Decoder = MoveTemp(Decoder);
+		}
+		return Map;
+	}
+
+	const FStructMap& FindOrBuild(const UScriptStruct* Struct)
+	{
+		FStructMapCache& Cache = GetCache();
+		{
+			FRWScopeLock ScopeLock(Cache.Lock, SLT_ReadOnly);
+			if (const TUniquePtr<FStructMap>* Found = Cache.Maps.Find(Struct))
+			{
+				return **Found;
+			}
+		}
+
+		GENAI_TRACE_SCOPE("GenAI::BuildStructMap");
+		FRWScopeLock ScopeLock(Cache.Lock, SLT_Write);
+		return FindOrBuildLocked(Cache, Struct);
+	}
+}
+
+bool FGenStructDecoder::Decode(const UScriptStruct* Struct, void* Data, TConstArrayView<uint8> Utf8Json, FString* OutError)
+{
+	GENAI_TRACE_SCOPE("GenAI::DecodeStruct");
+	if (!Struct || !Data)
+	{
+		if (OutError)
+		{
+			*OutError = TEXT("No struct to decode into");
+		}
+		return false;
+	}
+
+	FDecodeContext Context(Utf8Json);
+	if (Context.Reader.Next() != EGenJsonToken::ObjectStart)
+	{
+		Fail(Context, FString::Printf(TEXT("Expected an object for %s"), *Struct->GetName()));
+	}
+	else if (DecodeObject(Context, FindOrBuild(Struct), Data))
+	{
+		return true;
+	}
+
+	UE_LOG(LogGenAI, Warning, TEXT("Failed to decode %s: %s"), *Struct->GetName(), *Context.Error);
+	if (OutError)
+	{
+		*OutError = MoveTemp(Context.Error);
+	}
+	return false;
+}
+
+bool FGenStructDecoder::Decode(const UScriptStruct* Struct, void* Data, FStringView Json, FString* OutError)
+{
+	const FTCHARToUTF8 Utf8(Json.GetData(), Json.Len());
+	return Decode(Struct, Data, TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()), OutError);
+}
+
+void FGenStructDecoder::Prepare(const UScriptStruct* Struct)
+{
+	if (Struct)
+	{
+		FindOrBuild(Struct);
+	}
+}
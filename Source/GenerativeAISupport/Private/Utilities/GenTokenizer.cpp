@@ -0,0 +1,705 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Utilities/GenTokenizer.h"
+
+#include "Hash/CityHash.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Utilities/GenGlobalDefinitions.h"
+#include "Utilities/GenTrace.h"
+
+namespace
+{
+	// Character classes of the split patterns, \p{L}, \p{Lu} / \p{Ll}, \p{M}, \p{N} and \s
+	enum ECharFlags : uint8
+	{
+		CF_Letter = 1 << 0,
+		CF_Upper = 1 << 1,
+		CF_Lower = 1 << 2,
+		CF_Mark = 1 << 3,
+		CF_Number = 1 << 4,
+		CF_Space = 1 << 5,
+		CF_Newline = 1 << 6
+	};
+
+	struct FCodePoint
+	{
+		uint32 Char = 0;
+		int32 ByteOffset = 0;
+		uint8 Flags = 0;
+	};
+
+	uint8 ClassifyCased(bool bUpper)
+	{
+		return CF_Letter | (bUpper ? CF_Upper : CF_Lower);
+	}
+
+	uint8 Classify(uint32 Char)
+	{
+		if (Char < 0x80)
+		{
+			if (Char >= 'a' && Char <= 'z') return CF_Letter | CF_Lower;
+			if (Char >= 'A' && Char <= 'Z') return CF_Letter | CF_Upper;
+			if (Char >= '0' && Char <= '9') return CF_Number;
+			if (Char == '\r' || Char == '\n') return CF_Space | CF_Newline;
+			if (Char == ' ' || (Char >= '\t' && Char <= '\f')) return CF_Space;
+			return 0;
+		}
+
+		// Whitespace beyond ASCII
+		if (Char == 0x85 || Char == 0xA0 || Char == 0x1680 || (Char >= 0x2000 && Char <= 0x200A)
+			|| Char == 0x2028 || Char == 0x2029 || Char == 0x202F || Char == 0x205F || Char == 0x3000)
+		{
+			return CF_Space;
+		}
+
+		// Latin-1 symbols, except the ordinal indicators and the micro sign
+		if (Char < 0xC0)
+		{
+			return Char == 0xAA || Char == 0xB5 || Char == 0xBA ? CF_Letter | CF_Lower : 0;
+		}
+		if (Char == 0xD7 || Char == 0xF7)
+		{
+			return 0;
+		}
+		if (Char < 0x100) return ClassifyCased(Char < 0xDF);
+		// Latin Extended-A pairs an upper case letter with the lower case one that follows, close enough for Extended-B
+		if (Char < 0x250) return ClassifyCased((Char & 1) == 0);
+		if (Char >= 0x300 && Char < 0x370) return CF_Mark;
+		if (Char >= 0x391 && Char <= 0x3A9) return ClassifyCased(true);
+		if (Char >= 0x3B1 && Char <= 0x3C9) return ClassifyCased(false);
+		if (Char >= 0x400 && Char < 0x430) return ClassifyCased(true);
+		if (Char >= 0x430 && Char < 0x460) return ClassifyCased(false);
+		if ((Char >= 0x660 && Char <= 0x669) || (Char >= 0x6F0 && Char <= 0x6F9) || (Char >= 0x966 && Char <= 0x96F)
+			|| (Char >= 0xFF10 && Char <= 0xFF19))
+		{
+			return CF_Number;
+		}
+		if (Char >= 0x1AB0 && Char < 0x1B00) return CF_Mark;
+		if (Char >= 0x20D0 && Char < 0x2100) return CF_Mark;
+		// General punctuation, symbols, arrows, box drawing, CJK punctuation, private use, full width punctuation and emoji
+		if ((Char >= 0x2000 && Char < 0x2C00) || (Char >= 0x3000 && Char < 0x3040) || (Char >= 0xE000 && Char < 0xF900)
+			|| (Char >= 0xFE00 && Char < 0xFE70) || (Char >= 0xFF00 && Char < 0xFF21) || (Char >= 0xFF3B && Char < 0xFF41)
+			|| (Char >= 0xFF5B && Char < 0xFF66) || (Char >= 0x1F000 && Char < 0x1FB00))
+		{
+			return 0;
+		}
+		// Everything else is taken for an uncased letter: CJK, kana, hangul, Arabic, Hebrew, Indic scripts, ...
+		return CF_Letter;
+	}
+
+	// Decodes UTF-8, a byte that does not start a valid sequence becomes a code point of its own
+	void DecodeCodePoints(TConstArrayView<uint8> Utf8, TArray<FCodePoint>& OutCodePoints)
+	{
+		OutCodePoints.Reset(Utf8.Num());
+		const uint8* Data = Utf8.GetData();
+		const int32 Num = Utf8.Num();
+		int32 Index = 0;
+		while (Index < Num)
+		{
+			FCodePoint& CodePoint = OutCodePoints.AddDefaulted_GetRef();
+			CodePoint.ByteOffset = Index;
+
+			const uint8 Lead = Data[Index];
+			int32 Length = 1;
+			uint32 Char = Lead;
+			if (Lead >= 0xC0)
+			{
+				Length = Lead >= 0xF0 ? 4 : (Lead >= 0xE0 ? 3 : 2);
+				Char = Lead & (0x3F >> (Length - 1));
+				for (int32 Continuation = 1; Continuation < Length; ++Continuation)
+				{
+					if (Index + Continuation >= Num || (Data[Index + Continuation] & 0xC0) != 0x80)
+					{
+						Length = 1;
+						Char = Lead;
+						break;
+					}
+					Char = (Char << 6) | (Data[Index + Continuation] & 0x3F);
+				}
+			}
+
+			CodePoint.Char = Char;
+			CodePoint.Flags = Length == 1 && Lead >= 0x80 ? 0 : Classify(Char);
+			Index += Length;
+		}
+	}
+
+	bool IsLetter(uint8 Flags) { return (Flags & CF_Letter) != 0; }
+	bool IsNumber(uint8 Flags) { return (Flags & CF_Number) != 0; }
+	bool IsSpace(uint8 Flags) { return (Flags & CF_Space) != 0; }
+	bool IsNewline(uint8 Flags) { return (Flags & CF_Newline) != 0; }
+
+	// [^\r\n\p{L}\p{N}]
+	bool IsPrefix(uint8 Flags) { return (Flags & (CF_Letter | CF_Number | CF_Newline)) == 0; }
+
+	// [^\s\p{L}\p{N}]
+	bool IsPunctuation(uint8 Flags) { return (Flags & (CF_Letter | CF_Number | CF_Space)) == 0; }
+
+	// o200k's [\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}] and [\p{Ll}\p{Lm}\p{Lo}\p{M}], uncased letters are in both
+	bool IsUpperClass(uint8 Flags) { return (Flags & CF_Mark) || ((Flags & CF_Letter) && !(Flags & CF_Lower)); }
+	bool IsLowerClass(uint8 Flags) { return (Flags & CF_Mark) || ((Flags & CF_Letter) && !(Flags & CF_Upper)); }
+
+	uint32 ToLowerAscii(uint32 Char)
+	{
+		return Char >= 'A' && Char <= 'Z' ? Char + ('a' - 'A') : Char;
+	}
+
+	// (?i:'s|'t|'re|'ve|'m|'ll|'d), the same set for both encodings, returns the length including the apostrophe
+	int32 MatchContraction(const FCodePoint* CodePoints, int32 Num, int32 Index)
+	{
+		if (Index + 1 >= Num || CodePoints[Index].Char != '\'')
+		{
+			return 0;
+		}
+		const uint32 First = ToLowerAscii(CodePoints[Index + 1].Char);
+		if (First == 's' || First == 't' || First == 'm' || First == 'd')
+		{
+			return 2;
+		}
+		if (Index + 2 < Num)
+		{
+			const uint32 Second = ToLowerAscii(CodePoints[Index + 2].Char);
+			if ((First == 'r' && Second == 'e') || (First == 'v' && Second == 'e') || (First == 'l' && Second == 'l'))
+			{
+				return 3;
+			}
+		}
+		return 0;
+	}
+
+	// \p{N}{1,3}
+	int32 MatchNumbers(const FCodePoint* CodePoints, int32 Num, int32 Index)
+	{
+		int32 End = Index + 1;
+		while (End < Num && End < Index + 3 && IsNumber(CodePoints[End].Flags))
+		{
+			++End;
+		}
+		return End;
+	}
+
+	// ` ?[^\s\p{L}\p{N}]+` followed by the characters the encoding lets trail it, INDEX_NONE when no punctuation starts here
+	int32 MatchPunctuation(const FCodePoint* CodePoints, int32 Num, int32 Index, bool bTrailingSlash)
+	{
+		int32 End = Index;
+		if (CodePoints[End].Char == ' ' && End + 1 < Num && IsPunctuation(CodePoints[End + 1].Flags))
+		{
+			++End;
+		}
+		if (!IsPunctuation(CodePoints[End].Flags))
+		{
+			return INDEX_NONE;
+		}
+		while (End < Num && IsPunctuation(CodePoints[End].Flags))
+		{
+			++End;
+		}
+		while (End < Num && (IsNewline(CodePoints[End].Flags) || (bTrailingSlash && CodePoints[End].Char == '/')))
+		{
+			++End;
+		}
+		return End;
+	}
+
+	// \s*[\r\n]+ | \s+(?!\S) | \s+, the run ends at its last line break, or leaves its last space to the word after it
+	int32 MatchWhitespace(const FCodePoint* CodePoints, int32 Num, int32 Index)
+	{
+		int32 End = Index;
+		int32 LastNewline = INDEX_NONE;
+		while (End < Num && IsSpace(CodePoints[End].Flags))
+		{
+			if (IsNewline(CodePoints[End].Flags))
+			{
+				LastNewline = End;
+			}
+			++End;
+		}
+		if (LastNewline != INDEX_NONE)
+		{
+			return LastNewline + 1;
+		}
+		if (End == Num || End - Index <= 1)
+		{
+			// Never an empty piece, whatever the classes say
+			return FMath::Max(End, Index + 1);
+		}
+		return End - 1;
+	}
+
+	// '(?i:[sdmt]|ll|ve|re)|[^\r\n\p{L}\p{N}]?+\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]++[\r\n]*|\s*[\r\n]|\s+(?!\S)|\s+
+	int32 SplitCl100k(const FCodePoint* CodePoints, int32 Num, int32 Index)
+	{
+		if (const int32 Contraction = MatchContraction(CodePoints, Num, Index))
+		{
+			return Index + Contraction;
+		}
+
+		const uint8 Flags = CodePoints[Index].Flags;
+		int32 Start = INDEX_NONE;
+		if (IsLetter(Flags))
+		{
+			Start = Index;
+		}
+		else if (IsPrefix(Flags) && Index + 1 < Num && IsLetter(CodePoints[Index + 1].Flags))
+		{
+			Start = Index + 1;
+		}
+		if (Start != INDEX_NONE)
+		{
+			int32 End = Start + 1;
+			while (End < Num && IsLetter(CodePoints[End].Flags))
+			{
+				++End;
+			}
+			return End;
+		}
+
+		if (IsNumber(Flags))
+		{
+			return MatchNumbers(CodePoints, Num, Index);
+		}
+
+		const int32 PunctuationEnd = MatchPunctuation(CodePoints, Num, Index, false);
+		return PunctuationEnd != INDEX_NONE ? PunctuationEnd : MatchWhitespace(CodePoints, Num, Index);
+	}
+
+	// [^\r\n\p{L}\p{N}]?[\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]*[\p{Ll}\p{Lm}\p{Lo}\p{M}]+(?i:'s|'t|'re|'ve|'m|'ll|'d)?
+	// |[^\r\n\p{L}\p{N}]?[\p{Lu}\p{Lt}\p{Lm}\p{Lo}\p{M}]+[\p{Ll}\p{Lm}\p{Lo}\p{M}]*(?i:'s|'t|'re|'ve|'m|'ll|'d)?
+	// |\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n/]*|\s*[\r\n]+|\s+(?!\S)|\s+
+	int32 SplitO200k(const FCodePoint* CodePoints, int32 Num, int32 Index)
+	{
+		const uint8 Flags = CodePoints[Index].Flags;
+		const auto IsWordChar = [](uint8 CharFlags) { return (CharFlags & (CF_Letter | CF_Mark)) != 0; };
+
+		int32 Start = INDEX_NONE;
+		if (IsWordChar(Flags))
+		{
+			Start = Index;
+		}
+		else if (IsPrefix(Flags) && Index + 1 < Num && IsWordChar(CodePoints[Index + 1].Flags))
+		{
+			Start = Index + 1;
+		}
+		if (Start != INDEX_NONE)
+		{
+			// Upper case run, then lower case run, "helloWorld" splits before the "W" while "HTTPServer" stays one piece
+			int32 UpperEnd = Start;
+			while (UpperEnd < Num && IsUpperClass(CodePoints[UpperEnd].Flags))
+			{
+				++UpperEnd;
+			}
+			int32 End = UpperEnd;
+			while (End < Num && IsLowerClass(CodePoints[End].Flags))
+			{
+				++End;
+			}
+			return End + MatchContraction(CodePoints, Num, End);
+		}
+
+		if (IsNumber(Flags))
+		{
+			return MatchNumbers(CodePoints, Num, Index);
+		}
+
+		const int32 PunctuationEnd = MatchPunctuation(CodePoints, Num, Index, true);
+		return PunctuationEnd != INDEX_NONE ? PunctuationEnd : MatchWhitespace(CodePoints, Num, Index);
+	}
+
+	FString Utf8ToString(const uint8* Data, int32 Length)
+	{
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), Length);
+		return FString(Converter.Length(), Converter.Get());
+	}
+
+	struct FLoadedTokenizer
+	{
+		TUniquePtr<FGenTokenizer> Tokenizer;
+		bool bAttempted = false;
+	};
+
+	FCriticalSection TokenizersLock;
+	FLoadedTokenizer Tokenizers[2];
+}
+
+const FGenTokenizer* FGenTokenizer::Get(EGenTokenizerEncoding Encoding)
+{
+	FScopeLock Lock(&TokenizersLock);
+	FLoadedTokenizer& Loaded = Tokenizers[static_cast<int32>(Encoding)];
+	if (Loaded.bAttempted)
+	{
+		return Loaded.Tokenizer.Get();
+	}
+	Loaded.bAttempted = true;
+
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("GenerativeAISupport"));
+	if (!Plugin.IsValid())
+	{
+		return nullptr;
+	}
+
+	const FString FilePath = FPaths::Combine(Plugin->GetContentDir(), TEXT("Tokenizers"), FString(GetEncodingName(Encoding)) + TEXT(".tiktoken"));
+	const double StartTime = FPlatformTime::Seconds();
+	TUniquePtr<FGenTokenizer> Tokenizer = MakeUnique<FGenTokenizer>();
+	if (!Tokenizer->LoadFromFile(FilePath, Encoding))
+	{
+		UE_LOG(LogGenAI, Warning, TEXT("Tokenizer vocab %s not found or invalid, token counts are estimated"), *FilePath);
+		return nullptr;
+	}
+
+	UE_LOG(LogGenPerformance, Log, TEXT("Loaded %s tokenizer, %d tokens in %.1f ms"), GetEncodingName(Encoding), Tokenizer->GetVocabSize(),
+	       (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	Loaded.Tokenizer = MoveTemp(Tokenizer);
+	return Loaded.Tokenizer.Get();
+}
+
+EGenTokenizerEncoding FGenTokenizer::GetEncodingForModel(const FString& Model)
+{
+	// gpt-4 and gpt-3.5, but not the gpt-4o / gpt-4.1 / gpt-4.5 generations
+	const bool bGpt4 = Model.StartsWith(TEXT("gpt-4")) && !Model.StartsWith(TEXT("gpt-4o")) && !Model.StartsWith(TEXT("gpt-4."));
+	if (bGpt4 || Model.StartsWith(TEXT("gpt-3.5")) || Model.StartsWith(TEXT("text-embedding")))
+	{
+		return EGenTokenizerEncoding::CL100K;
+	}
+	return EGenTokenizerEncoding::O200K;
+}
+
+const TCHAR* FGenTokenizer::GetEncodingName(EGenTokenizerEncoding Encoding)
+{
+	return Encoding == EGenTokenizerEncoding::CL100K ? TEXT("cl100k_base") : TEXT("o200k_base");
+}
+
+int32 FGenTokenizer::CountTokensOrEstimate(EGenTokenizerEncoding Encoding, FStringView Text)
+{
+	if (const FGenTokenizer* Tokenizer = Get(Encoding))
+	{
+		return Tokenizer->CountTokens(Text);
+	}
+	return (Text.Len() + 3) / 4;
+}
+
+int32 FGenTokenizer::CountChatTokensOrEstimate(EGenTokenizerEncoding Encoding, TConstArrayView<FGenChatMessage> Messages)
+{
+	const FGenTokenizer* Tokenizer = Get(Encoding);
+	int32 Tokens = TokensPerReply;
+	for (const FGenChatMessage& Message : Messages)
+	{
+		Tokens += TokensPerMessage;
+		Tokens += Tokenizer ? Tokenizer->CountTokens(Message.Role) : (Message.Role.Len() + 3) / 4;
+		Tokens += Tokenizer ? Tokenizer->CountTokens(Message.Content) : (Message.Content.Len() + 3) / 4;
+	}
+	return Tokens;
+}
+
+bool FGenTokenizer::LoadFromFile(const FString& FilePath, EGenTokenizerEncoding InEncoding)
+{
+	TArray<uint8> File;
+	if (!FFileHelper::LoadFileToArray(File, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	Encoding = InEncoding;
+	TokenBytes.Reset();
+	Entries.Reset();
+
+	// "<base64> <rank>\n" per token
+	const ANSICHAR* Data = reinterpret_cast<const ANSICHAR*>(File.GetData());
+	const int32 Num = File.Num();
+	int32 LineStart = 0;
+	while (LineStart < Num)
+	{
+		int32 LineEnd = LineStart;
+		while (LineEnd < Num && Data[LineEnd] != '\n')
+		{
+			++LineEnd;
+		}
+
+		int32 Separator = LineStart;
+		while (Separator < LineEnd && Data[Separator] != ' ')
+		{
+			++Separator;
+		}
+		if (Separator > LineStart && Separator < LineEnd)
+		{
+			const int32 Rank = FCStringAnsi::Atoi(Data + Separator + 1);
+			const uint32 EncodedLength = Separator - LineStart;
+			const uint32 DecodedLength = FBase64::GetDecodedDataSize(Data + LineStart, EncodedLength);
+			if (Rank < 0 || DecodedLength == 0)
+			{
+				return false;
+			}
+
+			const int32 Offset = TokenBytes.AddUninitialized(DecodedLength);
+			if (!FBase64::Decode(Data + LineStart, EncodedLength, TokenBytes.GetData() + Offset))
+			{
+				return false;
+			}
+			if (Rank >= Entries.Num())
+			{
+				Entries.SetNum(Rank + 1);
+			}
+			Entries[Rank].Offset = Offset;
+			Entries[Rank].Length = DecodedLength;
+		}
+		LineStart = LineEnd + 1;
+	}
+
+	// Half full at most, keeps probe sequences short
+	const uint32 NumSlots = FMath::RoundUpToPowerOfTwo(FMath::Max(Entries.Num() * 2, 16));
+	Slots.Init(INDEX_NONE, NumSlots);
+	SlotMask = NumSlots - 1;
+	for (int32 Rank = 0; Rank < Entries.Num(); ++Rank)
+	{
+		const FEntry& Entry = Entries[Rank];
+		if (Entry.Length == 0)
+		{
+			continue;
+		}
+		uint32 Slot = static_cast<uint32>(CityHash64(reinterpret_cast<const char*>(TokenBytes.GetData() + Entry.Offset), Entry.Length)) & SlotMask;
+		while (Slots[Slot] != INDEX_NONE)
+		{
+			Slot = (Slot + 1) & SlotMask;
+		}
+		Slots[Slot] = Rank;
+	}
+
+	// Every byte has to be a token of its own, otherwise a merge could dead end
+	for (int32 Byte = 0; Byte < 256; ++Byte)
+	{
+		const uint8 Value = static_cast<uint8>(Byte);
+		ByteRanks[Byte] = FindRank(&Value, 1);
+		if (ByteRanks[Byte] == INDEX_NONE)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 FGenTokenizer::FindRank(const uint8* Data, int32 Length) const
+{
+	uint32 Slot = static_cast<uint32>(CityHash64(reinterpret_cast<const char*>(Data), Length)) & SlotMask;
+	for (;;)
+	{
+		const int32 Rank = Slots[Slot];
+		if (Rank == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+		const FEntry& Entry = Entries[Rank];
+		if (Entry.Length == Length && FMemory::Memcmp(TokenBytes.GetData() + Entry.Offset, Data, Length) == 0)
+		{
+			return Rank;
+		}
+		Slot = (Slot + 1) & SlotMask;
+	}
+}
+
+bool FGenTokenizer::EncodePiece(const uint8* Data, int32 Length, int32 PieceOffset, TFunctionRef<bool(int32 Rank, int32 EndOffset)> OnToken) const
+{
+	if (Length == 1)
+	{
+		return OnToken(ByteRanks[Data[0]], PieceOffset + 1);
+	}
+
+	// Most pieces are whole words that are tokens of their own
+	const int32 WholeRank = FindRank(Data, Length);
+	if (WholeRank != INDEX_NONE)
+	{
+		return OnToken(WholeRank, PieceOffset + Length);
+	}
+
+	// Byte pair merge: Parts holds the start of every part and the rank of merging it with the next one,
+	// the lowest ranked pair is merged until no pair is a token
+	struct FPart
+	{
+		int32 Start;
+		int32 Rank;
+	};
+	TArray<FPart, TInlineAllocator<64>> Parts;
+	Parts.SetNumUninitialized(Length + 1);
+	const auto PairRank = [this, Data, Length, &Parts](int32 Index)
+	{
+		if (Index + 2 >= Parts.Num())
+		{
+			return MAX_int32;
+		}
+		const int32 Rank = FindRank(Data + Parts[Index].Start, Parts[Index + 2].Start - Parts[Index].Start);
+		return Rank == INDEX_NONE ? MAX_int32 : Rank;
+	};
+	for (int32 Index = 0; Index <= Length; ++Index)
+	{
+		Parts[Index].Start = Index;
+	}
+	for (int32 Index = 0; Index <= Length; ++Index)
+	{
+		Parts[Index].Rank = PairRank(Index);
+	}
+
+	for (;;)
+	{
+		int32 MinRank = MAX_int32;
+		int32 MinIndex = INDEX_NONE;
+		for (int32 Index = 0; Index + 1 < Parts.Num(); ++Index)
+		{
+			if (Parts[Index].Rank < MinRank)
+			{
+				MinRank = Parts[Index].Rank;
+				MinIndex = Index;
+			}
+		}
+		if (MinIndex == INDEX_NONE)
+		{
+			break;
+		}
+
+		Parts.RemoveAt(MinIndex + 1, 1, EAllowShrinking::No);
+		Parts[MinIndex].Rank = PairRank(MinIndex);
+		if (MinIndex > 0)
+		{
+			Parts[MinIndex - 1].Rank = PairRank(MinIndex - 1);
+		}
+	}
+
+	for (int32 Index = 0; Index + 1 < Parts.Num(); ++Index)
+	{
+		const int32 PartLength = Parts[Index + 1].Start - Parts[Index].Start;
+		const int32 Rank = PartLength == 1 ? ByteRanks[Data[Parts[Index].Start]] : FindRank(Data + Parts[Index].Start, PartLength);
+		if (!OnToken(Rank, PieceOffset + Parts[Index + 1].Start))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FGenTokenizer::EncodeUtf8(TConstArrayView<uint8> Utf8, TFunctionRef<bool(int32 Rank, int32 EndOffset)> OnToken) const
+{
+	TArray<FCodePoint> CodePoints;
+	DecodeCodePoints(Utf8, CodePoints);
+
+	const bool bO200k = Encoding == EGenTokenizerEncoding::O200K;
+	const int32 Num = CodePoints.Num();
+	int32 Index = 0;
+	while (Index < Num)
+	{
+		const int32 End = bO200k ? SplitO200k(CodePoints.GetData(), Num, Index) : SplitCl100k(CodePoints.GetData(), Num, Index);
+		const int32 ByteStart = CodePoints[Index].ByteOffset;
+		const int32 ByteEnd = End < Num ? CodePoints[End].ByteOffset : Utf8.Num();
+		if (!EncodePiece(Utf8.GetData() + ByteStart, ByteEnd - ByteStart, ByteStart, OnToken))
+		{
+			return;
+		}
+		Index = End;
+	}
+}
+
+int32 FGenTokenizer::CountTokens(FStringView Text) const
+{
+	GENAI_TRACE_SCOPE("GenAI::CountTokens");
+	const FTCHARToUTF8 Converter(Text.GetData(), Text.Len());
+	return CountTokensUtf8(MakeArrayView(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length()));
+}
+
+int32 FGenTokenizer::CountTokensUtf8(TConstArrayView<uint8> Utf8) const
+{
+	int32 Count = 0;
+	EncodeUtf8(Utf8, [&Count](int32 Rank, int32 EndOffset)
+	{
+		++Count;
+		return true;
+	});
+	return Count;
+}
+
+void FGenTokenizer::Encode(FStringView Text, TArray<int32>& OutTokens) const
+{
+	GENAI_TRACE_SCOPE("GenAI::Tokenize");
+	OutTokens.Reset();
+	const FTCHARToUTF8 Converter(Text.GetData(), Text.Len());
+	EncodeUtf8(MakeArrayView(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length()), [&OutTokens](int32 Rank, int32 EndOffset)
+	{
+		OutTokens.Add(Rank);
+		return true;
+	});
+}
+
+FString FGenTokenizer::Decode(TConstArrayView<int32> Tokens) const
+{
+	TArray<uint8> Bytes;
+	for (const int32 Rank : Tokens)
+	{
+		if (Entries.IsValidIndex(Rank))
+		{
+			Bytes.Append(TokenBytes.GetData() + Entries[Rank].Offset, Entries[Rank].Length);
+		}
+	}
+	return Utf8ToString(Bytes.GetData(), Bytes.Num());
+}
+
+FString FGenTokenizer::Truncate(FStringView Text, int32 MaxTokens) const
+{
+	const FTCHARToUTF8 Converter(Text.GetData(), Text.Len());
+	const uint8* Utf8 = reinterpret_cast<const uint8*>(Converter.Get());
+
+	int32 Count = 0;
+	int32 CutOffset = 0;
+	bool bExceeded = false;
+	EncodeUtf8(MakeArrayView(Utf8, Converter.Length()), [&Count, &CutOffset, &bExceeded, MaxTokens](int32 Rank, int32 EndOffset)
+	{
+		if (++Count > MaxTokens)
+		{
+			bExceeded = true;
+			return false;
+		}
+		CutOffset = EndOffset;
+		return true;
+	});
+
+	if (!bExceeded)
+	{
+		return FString(Text);
+	}
+
+	// Byte level tokens can end inside a multi byte character, drop the partial character
+	while (CutOffset > 0 && (Utf8[CutOffset] & 0xC0) == 0x80)
+	{
+		--CutOffset;
+	}
+	return Utf8ToString(Utf8, CutOffset);
+}
+
+int32 UGenTokenizerLibrary::CountTokens(const FString& Text, EGenTokenizerEncoding Encoding)
+{
+	return FGenTokenizer::CountTokensOrEstimate(Encoding, Text);
+}
+
+int32 UGenTokenizerLibrary::CountTokensForModel(const FString& Text, const FString& Model)
+{
+	return FGenTokenizer::CountTokensOrEstimate(FGenTokenizer::GetEncodingForModel(Model), Text);
+}
+
+int32 UGenTokenizerLibrary::CountChatTokens(const TArray<FGenChatMessage>& Messages, EGenTokenizerEncoding Encoding)
+{
+	return FGenTokenizer::CountChatTokensOrEstimate(Encoding, Messages);
+}
+
+FString UGenTokenizerLibrary::TruncateToTokens(const FString& Text, int32 MaxTokens, EGenTokenizerEncoding Encoding)
+{
+	if (const FGenTokenizer* Tokenizer = FGenTokenizer::Get(Encoding))
+	{
+		return Tokenizer->Truncate(Text, FMath::Max(MaxTokens, 0));
+	}
+	return Text.Left(FMath::Max(MaxTokens, 0) * 4);
+}
+
+bool UGenTokenizerLibrary::IsTokenizerAvailable(EGenTokenizerEncoding Encoding)
+{
+	return FGenTokenizer::Get(Encoding) != nullptr;
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#include "Utilities/GenTrace.h"
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(GenAIChannel);
+
+TRACE_DECLARE_INT_COUNTER(GenAIQueuedRequests, TEXT("GenAI/QueuedRequests"));
+TRACE_DECLARE_INT_COUNTER(GenAIInFlightRequests, TEXT("GenAI/InFlightRequests"));
+TRACE_DECLARE_MEMORY_COUNTER(GenAIBytesSent, TEXT("GenAI/BytesSent"));
+TRACE_DECLARE_MEMORY_COUNTER(GenAIBytesReceived, TEXT("GenAI/BytesReceived"));
+TRACE_DECLARE_INT_COUNTER(GenAICacheHits, TEXT("GenAI/CacheHits"));
+TRACE_DECLARE_INT_COUNTER(GenAICoalescedRequests, TEXT("GenAI/CoalescedRequests"));
+
+void FGenTrace::RequestQueued()
+{
+	TRACE_COUNTER_INCREMENT(GenAIQueuedRequests);
+}
+
+void FGenTrace::RequestDequeued()
+{
+	TRACE_COUNTER_DECREMENT(GenAIQueuedRequests);
+}
+
+void FGenTrace::RequestSent()
+{
+	TRACE_COUNTER_INCREMENT(GenAIInFlightRequests);
+}
+
+void FGenTrace::RequestFinished()
+{
+	TRACE_COUNTER_DECREMENT(GenAIInFlightRequests);
+}
+
+void FGenTrace::AddBytesSent(int64 Bytes)
+{
+	TRACE_COUNTER_ADD(GenAIBytesSent, Bytes);
+}
+
+void FGenTrace::AddBytesReceived(int64 Bytes)
+{
+	TRACE_COUNTER_ADD(GenAIBytesReceived, Bytes);
+}
+
+void FGenTrace::CacheHit()
+{
+	TRACE_COUNTER_INCREMENT(GenAICacheHits);
+}
+
+void FGenTrace::RequestCoalesced()
+{
+	TRACE_COUNTER_INCREMENT(GenAICoalescedRequests);
+}
+
+FString FGenTrace::BeginRequestRegion(const TCHAR* ProviderName, const FString& Model)
+{
+#if MISCTRACE_ENABLED
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(GenAIChannel))
+	{
+		// Regions are matched by name, the id keeps concurrent requests to one model apart
+		static uint32 NextRegionId = 0;
+		FString Region = FString::Printf(TEXT("GenAI %s %s #%u"), ProviderName, *Model, ++NextRegionId);
+		TRACE_BEGIN_REGION(*Region);
+		return Region;
+	}
+#endif
+	return FString();
+}
+
+void FGenTrace::EndRequestRegion(FString& Region)
+{
+#if MISCTRACE_ENABLED
+	if (!Region.IsEmpty())
+	{
+		TRACE_END_REGION(*Region);
+	}
+#endif
+	Region.Reset();
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Data/GenRequestOptions.h"
 #include "Data/OpenAI/GenOAIChatStructs.h"
 #include "UObject/Object.h"
 #include "GenClaudeChatStructs.generated.h"
@@ -22,6 +23,32 @@ enum class EClaudeModels : uint8
 	Custom UMETA(DisplayName = "Custom Model")
 };
 
+// How long a cached prompt prefix stays alive after its last use
+UENUM(BlueprintType)
+enum class EGenClaudeCacheTTL : uint8
+{
+	FiveMinutes UMETA(DisplayName = "5 Minutes"),
+	// Cache writes cost more than with the 5 minute TTL, pays off for prefixes reused less often than every few minutes
+	OneHour UMETA(DisplayName = "1 Hour")
+};
+
+/**
+ * One block of the top level system prompt.
+ * A cache breakpoint caches the whole prompt up to and including its block, so stable blocks (persona, rules, world lore)
+ * go first and the breakpoint on the last of them, see https://docs.anthropic.com/en/docs/build-with-claude/prompt-caching
+ */
+USTRUCT(BlueprintType)
+struct FGenClaudeSystemBlock
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Claude API", meta = (MultiLine = "true"))
+	FString Text;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Claude API")
+	bool bCacheBreakpoint = false;
+};
+
 USTRUCT(BlueprintType)
 struct FGenClaudeChatSettings
 {
@@ -42,8 +69,24 @@ struct FGenClaudeChatSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Claude API")
 	bool bStreamResponse = false;
 
+	// Sent as the top level system prompt, before any "system" role entries of Messages
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Claude API")
+	TArray<FGenClaudeSystemBlock> SystemBlocks;
+
+	// "system" role entries are moved into the top level system prompt, the Messages API has no system role
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Claude API")
 	TArray<FGenChatMessage> Messages;
+
+	// Puts a cache breakpoint on the last message, so the next turn of the conversation reads everything before it from the cache
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Claude API")
+	bool bCacheMessageHistory = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Claude API")
+	EGenClaudeCacheTTL CacheTTL = EGenClaudeCacheTTL::FiveMinutes;
+
+	// Caching and other per-request behaviour shared by all providers
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Claude API")
+	FGenRequestOptions RequestOptions;
 };
 
 /**
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GenCancellationToken.generated.h"
+
+/**
+ * Shared cancellation flag. Copies of a token refer to the same flag, so one token handed to every request of an NPC
+ * cancels all of them at once, wherever they are: queued, connecting, streaming or waiting for a retry.
+ * A default constructed token is never cancelled. Game thread only.
+ */
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenCancellationToken
+{
+	GENERATED_BODY()
+
+	static FGenCancellationToken Create();
+
+	// Runs every registered callback once, later calls do nothing
+	void Cancel() const;
+
+	bool IsCancelled() const { return State.IsValid() && State->bCancelled; }
+	bool IsValid() const { return State.IsValid(); }
+
+	// Callback runs when the token is cancelled, nothing is registered for tokens that are invalid or already cancelled
+	FDelegateHandle AddOnCancelled(FSimpleDelegate Callback) const;
+	void RemoveOnCancelled(FDelegateHandle Handle) const;
+
+private:
+	struct FState
+	{
+		bool bCancelled = false;
+		FSimpleMulticastDelegate OnCancelled;
+	};
+
+	TSharedPtr<FState> State;
+};
+
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenCancellationLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Pass the token in the request options of every request it should be able to cancel
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Request")
+	static FGenCancellationToken MakeCancellationToken();
+
+	// Requests still running fail with "Request cancelled" and release their connection straight away
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Request")
+	static void CancelToken(const FGenCancellationToken& Token);
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Request")
+	static bool IsTokenCancelled(const FGenCancellationToken& Token);
+};
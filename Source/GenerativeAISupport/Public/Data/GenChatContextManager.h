@@ -0,0 +1,177 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/Anthropic/GenClaudeChatStructs.h"
+#include "Data/GenAIOrgs.h"
+#include "Data/GenConversation.h"
+#include "Data/OpenAI/GenOAIChatStructs.h"
+#include "Network/GenRequestEngine.h"
+#include "UObject/Object.h"
+#include "Utilities/GenTokenizer.h"
+#include "GenChatContextManager.generated.h"
+
+/**
+ * How a UGenChatContextManager keeps a growing conversation inside the prompt budget
+ */
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenContextPolicy
+{
+	GENERATED_BODY()
+
+	// Prompt tokens every request stays under, pinned messages and the summary included
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context", meta = (ClampMin = "256"))
+	int32 MaxPromptTokens = 8000;
+
+	// Optional latency budget, prompt processing time grows with the prompt, 0 disables it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context", meta = (ClampMin = "0", Units = "Seconds"))
+	float MaxPromptSeconds = 0.0f;
+
+	// Prompt processing speed assumed for MaxPromptSeconds
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context", meta = (ClampMin = "1", EditCondition = "MaxPromptSeconds > 0"))
+	float PromptTokensPerSecond = 4000.0f;
+
+	// Trimming goes down to this share of the budget, so the window is not rebuilt on every turn once it is full
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context", meta = (ClampMin = "0.1", ClampMax = "1.0"))
+	float TrimTargetRatio = 0.75f;
+
+	// Newest messages that are never trimmed while the budget allows it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context", meta = (ClampMin = "1"))
+	int32 MinRecentMessages = 6;
+
+	// "system" messages are kept ahead of the window instead of sliding out with the turns around them
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context")
+	bool bPinSystemMessages = true;
+
+	// Trimmed turns are folded into a running summary by SummaryModel, in the background
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context")
+	bool bSummarizeTrimmedTurns = true;
+
+	// OpenAI or Anthropic, Unknown uses the provider of the chat the context was last applied to
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context", meta = (EditCondition = "bSummarizeTrimmedTurns"))
+	EGenAIOrgs SummaryOrg = EGenAIOrgs::Unknown;
+
+	// Model name as the provider spells it, empty uses gpt-4.1-nano or claude-3-5-haiku-latest
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context", meta = (EditCondition = "bSummarizeTrimmedTurns"))
+	FString SummaryModel;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context", meta = (EditCondition = "bSummarizeTrimmedTurns", ClampMin = "32"))
+	int32 SummaryMaxTokens = 400;
+
+	// Tokenizer used for the budget, pick the one of the model the conversation is sent to
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Context")
+	EGenTokenizerEncoding Encoding = EGenTokenizerEncoding::O200K;
+
+	// Effective prompt budget, the stricter of the token and the latency budget
+	int32 GetPromptBudget() const
+	{
+		const int32 LatencyBudget = MaxPromptSeconds > 0.0f ? FMath::FloorToInt32(MaxPromptSeconds * PromptTokensPerSecond) : MAX_int32;
+		return FMath::Min(MaxPromptTokens, LatencyBudget);
+	}
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGenContextSummaryUpdatedDelegate, const FString&, Summary);
+
+/**
+ * Sliding window over a conversation that keeps every request under FGenContextPolicy's budget.
+ *
+ * Pinned messages and the running summary form a prefix that is serialized once and reused until the summary changes.
+ * The newest turns follow it, when they outgrow the budget the oldest are trimmed down to TrimTargetRatio of it in one go
+ * and (optionally) handed to a cheaper model of the same provider that folds them into the summary, the next request picks the new summary up.
+ * Appending a turn while nothing is trimmed costs the new message only, like FGenConversation.
+ * Game thread only.
+ */
+UCLASS(BlueprintType)
+class GENERATIVEAISUPPORT_API UGenChatContextManager : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Context")
+	static UGenChatContextManager* CreateChatContextManager(const FGenContextPolicy& Policy);
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Context")
+	void SetPolicy(const FGenContextPolicy& InPolicy);
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Context")
+	const FGenContextPolicy& GetPolicy() const { return Policy; }
+
+	// Adds a turn, "system" messages are pinned when the policy says so
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Context")
+	void AddMessage(const FString& Role, const FString& Content);
+
+	// Kept ahead of every request regardless of the budget
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Context")
+	void PinMessage(const FString& Role, const FString& Content);
+
+	// Messages the next request sends, pinned messages and summary first
+	UFUNCTION(BlueprintPure, Category = "GenAI|Context")
+	TArray<FGenChatMessage> GetContextMessages() const { return Window.GetMessages(); }
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Context")
+	int32 GetContextTokens() const { return PrefixTokens + WindowTurnTokens + FGenTokenizer::TokensPerReply; }
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Context")
+	const FString& GetSummary() const { return Summary; }
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Context")
+	void Clear();
+
+	// Replaces the settings' messages with the context, the window's cached JSON is shared, not copied
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Context")
+	void ApplyToOpenAIChat(UPARAM(ref) FGenChatSettings& ChatSettings);
+
+	// Replaces the settings' messages with the context and caches the prompt up to the newest turn on Anthropic's side
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Context")
+	void ApplyToClaudeChat(UPARAM(ref) FGenClaudeChatSettings& ChatSettings);
+
+	const FGenConversation& GetContext() const { return Window; }
+
+	UPROPERTY(BlueprintAssignable, Category = "GenAI|Context")
+	FGenContextSummaryUpdatedDelegate OnSummaryUpdated;
+
+private:
+	struct FTurn
+	{
+		FGenChatMessage Message;
+		int32 Tokens = 0;
+	};
+
+	int32 CountMessageTokens(const FString& Role, const FString& Content) const;
+
+	// Trims the oldest turns once the window is over budget
+	void EnforceBudget();
+
+	void RebuildPrefix();
+	void RebuildWindow();
+
+	void StartSummary();
+	void OnSummaryResponse(const FString& Response, const FString& Error, bool bSuccess);
+	void CapPendingSummaryTurns();
+
+	FGenContextPolicy Policy;
+
+	// Provider of the chat the context was last applied to, summarizes when the policy does not pick one
+	EGenAIOrgs ChatOrg = EGenAIOrgs::OpenAI;
+
+	TArray<FTurn> Pinned;
+	FString Summary;
+
+	// Every turn still in the window, oldest first
+	TArray<FTurn> Turns;
+
+	// Trimmed turns waiting to be folded into the summary, and the ones the running summary request covers
+	TArray<FGenChatMessage> PendingSummaryTurns;
+	TArray<FGenChatMessage> InFlightSummaryTurns;
+	int32 NumSummaryFailures = 0;
+	FGenRequestHandle SummaryRequest;
+
+	// Pinned messages and summary, then Turns
+	FGenConversation Prefix;
+	FGenConversation Window;
+	int32 PrefixTokens = 0;
+	int32 WindowTurnTokens = 0;
+};
@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/GenConversation.h"
+#include "Data/OpenAI/GenOAIChatStructs.h"
+#include "UObject/Object.h"
+#include "GenChatConversation.generated.h"
+
+/**
+ * Blueprint handle to an FGenConversation, keep one per NPC / dialogue and pass it to RequestOpenAIConversationChat.
+ * Forking shares the history so far, e.g. one persona conversation forked into every NPC that uses it.
+ */
+UCLASS(BlueprintType)
+class GENERATIVEAISUPPORT_API UGenChatConversation : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Conversation")
+	static UGenChatConversation* CreateChatConversation();
+
+	// New conversation starting with this one's messages, appending to either leaves the other unchanged
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Conversation")
+	UGenChatConversation* Fork() const;
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Conversation")
+	void AddMessage(const FString& Role, const FString& Content);
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Conversation")
+	void AddMessages(const TArray<FGenChatMessage>& Messages);
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Conversation")
+	TArray<FGenChatMessage> GetMessages() const { return Conversation.GetMessages(); }
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Conversation")
+	int32 GetNumMessages() const { return Conversation.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Conversation")
+	void Clear() { Conversation.Reset(); }
+
+	const FGenConversation& GetConversation() const { return Conversation; }
+	FGenConversation& GetConversation() { return Conversation; }
+
+private:
+	FGenConversation Conversation;
+};
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FGenJsonPayloadWriter;
+struct FGenChatMessage;
+struct FGenConversationChunk;
+
+/**
+ * Chat history made of immutable chunks shared by reference, each chunk keeps the JSON of its messages next to them.
+ * Copying a conversation copies one pointer, appending costs the new messages only and never touches older ones,
+ * so thousands of NPC conversations can be forked off one persona prefix and sent every turn without re-serializing it.
+ *
+ *     FGenConversation Persona;
+ *     Persona.Append(SystemMessage);
+ *     FGenConversation Npc = Persona;   // shares the persona chunk
+ *     Npc.Append(PlayerLine);           // adds a chunk, Persona is unchanged
+ *
+ * Chunks are never modified once created, conversations can be read from any thread, but a single conversation
+ * must not be appended to from two threads at once.
+ */
+class GENERATIVEAISUPPORT_API FGenConversation
+{
+public:
+	void Append(const FGenChatMessage& Message);
+	void Append(TConstArrayView<FGenChatMessage> Messages);
+	void Append(const FString& Role, const FString& Content);
+
+	int32 Num() const;
+	bool IsEmpty() const { return !Tail.IsValid(); }
+
+	// Bytes WriteMessages appends, commas between messages included
+	int32 GetSerializedSize() const;
+
+	// Copies the messages out, oldest first
+	TArray<FGenChatMessage> GetMessages() const;
+
+	// Writes every message as an element of the array the writer is in, from the cached JSON
+	void WriteMessages(FGenJsonPayloadWriter& Writer) const;
+
+	// Writes one message as an element of the array the writer is in, the format WriteMessages caches
+	static void WriteMessage(FGenJsonPayloadWriter& Writer, const FString& Role, const FString& Content);
+
+	void Reset() { Tail.Reset(); }
+
+private:
+	TSharedPtr<const FGenConversationChunk, ESPMode::ThreadSafe> Tail;
+};
@@ -0,0 +1,78 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/GenCancellationToken.h"
+#include "GenRequestOptions.generated.h"
+
+// How a request interacts with the response cache
+UENUM(BlueprintType)
+enum class EGenCachePolicy : uint8
+{
+	// Never read from or write to the cache
+	Bypass UMETA(DisplayName = "Bypass"),
+	// Serve identical requests from the cache, store fresh responses
+	ReadWrite UMETA(DisplayName = "Read/Write"),
+	// Serve identical requests from the cache, never store fresh responses
+	ReadOnly UMETA(DisplayName = "Read Only"),
+	// Always go to the network, store the fresh response over any cached one
+	Refresh UMETA(DisplayName = "Refresh")
+};
+
+// Scheduling class of a request, a lane is only served while every higher lane is empty
+UENUM(BlueprintType)
+enum class EGenRequestPriority : uint8
+{
+	// A player is waiting on the result
+	Interactive UMETA(DisplayName = "Interactive"),
+	// Drives gameplay, but nobody is staring at a spinner
+	Gameplay UMETA(DisplayName = "Gameplay"),
+	// Prefetching, summarisation and other work that can wait
+	Background UMETA(DisplayName = "Background")
+};
+
+/**
+ * Per-request options honoured by every provider request path, independent of the provider's own settings
+ */
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenRequestOptions
+{
+	GENERATED_BODY()
+
+	// Caching is opt-in, identical payloads are only served from the cache when this is not Bypass
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Request")
+	EGenCachePolicy CachePolicy = EGenCachePolicy::Bypass;
+
+	// Identical requests sent under the same API key while this one is still in flight attach to it instead of making
+	// their own round trip, and get the same answer. Opt-in, only turn it on where one answer for all is wanted, e.g.
+	// at temperature 0 or with a fixed seed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Request")
+	bool bCoalesceIdenticalRequests = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Request")
+	EGenRequestPriority Priority = EGenRequestPriority::Gameplay;
+
+	// Requests of one priority are shared fairly between callers, requests without a caller share one queue
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Request")
+	FName CallerId;
+
+	// Relative share of the caller within its priority lane, a caller with weight 2 is served twice as often as one with weight 1
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Request", meta = (ClampMin = "0.01"))
+	float CallerWeight = 1.0f;
+
+	// Retries after a 429 or a transient 5xx response, the response's retry-after is honoured and the wait is jittered
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Request", meta = (ClampMin = "0"))
+	int32 MaxRetries = 2;
+
+	// Time from sending until the result is delivered, retries included, after which the request fails and its connection
+	// is released, wherever it is: queued, connecting, streaming or parsing. 0 waits for the provider's HTTP timeout
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Request", meta = (ClampMin = "0", Units = "s"))
+	float DeadlineSeconds = 0.0f;
+
+	// Cancelling the token fails the request with "Request cancelled" and releases its connection, see FGenCancellationToken
+	UPROPERTY(BlueprintReadWrite, Category = "GenAI|Request")
+	FGenCancellationToken CancellationToken;
+};
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Data/GenConversation.h"
+#include "Data/GenRequestOptions.h"
 #include "Data/OpenAI/GenOAIModels.h"
 #include "GenOAIChatStructs.generated.h"
 
@@ -103,6 +105,13 @@ struct FGenChatSettings
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|OpenAI")
     TArray<FGenChatMessage> Messages;
+
+    // Native only, sent before Messages from its cached JSON, copying the settings shares the history instead of copying it
+    FGenConversation History;
+
+    // Receive the response incrementally as it is generated instead of waiting for the full body
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|OpenAI")
+    bool bStreamResponse = false;
     
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|OpenAI|GPT-5")
     EGenAIOpenAIReasoningEffort ReasoningEffort = EGenAIOpenAIReasoningEffort::Default;
@@ -110,17 +119,24 @@ struct FGenChatSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|OpenAI|GPT-5")
     EGenAIOpenAIVerbosity Verbosity = EGenAIOpenAIVerbosity::Default;
 
+    // Caching and other per-request behaviour shared by all providers
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|OpenAI")
+    FGenRequestOptions RequestOptions;
+
     // Helper function to ensure the Model field is correctly set from enum or custom value
     void UpdateModel()
+    {
+        Model = GetResolvedModel();
+    }
+
+    // The model name that will be sent, resolved from enum or custom value without modifying the settings
+    FString GetResolvedModel() const
     {
         if (ModelEnum == EGenOAIChatModel::Custom && !CustomModel.IsEmpty())
         {
-            Model = CustomModel;
-        }
-        else
-        {
-            Model = UGenOAIModelUtils::ChatModelToString(ModelEnum);
+            return CustomModel;
         }
+        return UGenOAIModelUtils::ChatModelToString(ModelEnum);
     }
 };
 
@@ -144,8 +160,17 @@ struct GENERATIVEAISUPPORT_API FGenOAIStructuredChatSettings
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GenAI")
     FString Name;
 
-    // JSON schema for structured outputs
+    // JSON schema for structured outputs, compiled once and cached by FGenSchemaRegistry
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GenAI")
     FString SchemaJson;
 
+    // Schema registered with FGenSchemaRegistry (or Register Schema), used instead of SchemaJson when set
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GenAI")
+    FName SchemaName;
+
+    // Struct the schema is derived from, used instead of SchemaName and SchemaJson when set. The response is sent in strict mode,
+    // so it always matches the struct
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GenAI")
+    TObjectPtr<const UScriptStruct> SchemaStruct = nullptr;
+
 };
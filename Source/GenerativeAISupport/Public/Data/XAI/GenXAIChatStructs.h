@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Data/GenRequestOptions.h"
 #include "GenXAIChatStructs.generated.h"
 
 // Data structure for XAI Grok chat messages
@@ -35,4 +36,12 @@ struct FGenXAIChatSettings
     // Array of messages for the conversation
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|XAI")
     TArray<FGenXAIMessage> Messages;
+
+    // Receive the response incrementally as it is generated instead of waiting for the full body
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|XAI")
+    bool bStreamResponse = false;
+
+    // Caching and other per-request behaviour shared by all providers
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|XAI")
+    FGenRequestOptions RequestOptions;
 };
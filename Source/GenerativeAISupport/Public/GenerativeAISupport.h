@@ -13,4 +13,7 @@ public:
     // IModuleInterface implementation
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+private:
+    FDelegateHandle EngineLoopInitHandle;
 };
@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/GenAIOrgs.h"
+#include "Engine/DeveloperSettings.h"
+#include "GenerativeAISupportRuntimeSettings.generated.h"
+
+/**
+ * Runtime settings for the Generative AI Support Plugin, available in packaged builds as well
+ */
+UCLASS(config=Game, defaultconfig, meta = (DisplayName = "Generative AI Support Runtime"))
+class GENERATIVEAISUPPORT_API UGenerativeAISupportRuntimeSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+    UGenerativeAISupportRuntimeSettings();
+
+    virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+    /** Maximum number of responses kept in the in-memory LRU response cache */
+    UPROPERTY(config, EditAnywhere, Category = "Response Cache", meta = (ClampMin = "1"))
+    int32 ResponseCacheMaxEntries;
+
+    /** Persist cached responses under Saved/GenAI/ResponseCache so they survive restarts */
+    UPROPERTY(config, EditAnywhere, Category = "Response Cache")
+    bool bPersistResponseCache;
+
+    /** Maximum number of requests in flight per provider, further requests wait in the scheduler's queue */
+    UPROPERTY(config, EditAnywhere, Category = "Request Scheduling", meta = (ClampMin = "1"))
+    TMap<EGenAIOrgs, int32> MaxConcurrentRequests;
+
+    /** Limit for providers without an entry in MaxConcurrentRequests */
+    UPROPERTY(config, EditAnywhere, Category = "Request Scheduling", meta = (ClampMin = "1"))
+    int32 DefaultMaxConcurrentRequests;
+
+    /** First retry of a rate limited or failed request waits up to this long, every further retry doubles it */
+    UPROPERTY(config, EditAnywhere, Category = "Retries", meta = (ClampMin = "0.0", Units = "s"))
+    float RetryBaseDelaySeconds;
+
+    /** Upper bound of the backoff between two retries */
+    UPROPERTY(config, EditAnywhere, Category = "Retries", meta = (ClampMin = "0.0", Units = "s"))
+    float RetryMaxDelaySeconds;
+
+    /** Retries earned per fresh request, 0.2 allows at most one retry for every five requests once the initial allowance is spent */
+    UPROPERTY(config, EditAnywhere, Category = "Retries", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float RetryBudgetRatio;
+
+    /** Replaces a provider's API host, e.g. http://127.0.0.1:8080 to run against Content/Python/mock_provider_server.py. -GenAIBaseUrl= on the command line overrides all of them */
+    UPROPERTY(config, EditAnywhere, Category = "Endpoints")
+    TMap<EGenAIOrgs, FString> BaseUrlOverrides;
+
+    /** Providers whose API host gets a connection opened at startup, once an API key is set for them. Empty by default, each warm-up sends unauthenticated HEAD requests to the provider */
+    UPROPERTY(config, EditAnywhere, Category = "Endpoints")
+    TArray<EGenAIOrgs> WarmConnectionProviders;
+
+    /** Interval of keep-alive pings on warmed connections, e.g. 45 s to stay below the usual 60 s idle timeout of the providers' load balancers. 0 (the default) only warms once */
+    UPROPERTY(config, EditAnywhere, Category = "Endpoints", meta = (ClampMin = "0.0", Units = "s"))
+    float ConnectionKeepAliveSeconds;
+
+    /** Providers (or local stand-ins) that accept gzip request bodies, bodies above RequestCompressionMinBytes are compressed for them */
+    UPROPERTY(config, EditAnywhere, Category = "Compression")
+    TArray<EGenAIOrgs> CompressRequestProviders;
+
+    /** Smaller bodies are not worth the CPU and the gzip header */
+    UPROPERTY(config, EditAnywhere, Category = "Compression", meta = (ClampMin = "0", Units = "Bytes"))
+    int32 RequestCompressionMinBytes;
+
+    /** Advertise gzip in Accept-Encoding, compressed responses (streamed ones included) are inflated as they arrive */
+    UPROPERTY(config, EditAnywhere, Category = "Compression")
+    bool bAcceptCompressedResponses;
+
+    /** How often the batch job subsystem asks providers for the status of running batches */
+    UPROPERTY(config, EditAnywhere, Category = "Batch Jobs", meta = (ClampMin = "1.0", Units = "s"))
+    float BatchPollIntervalSeconds;
+
+    /** Consecutive failures after which the provider router stops sending to a backend */
+    UPROPERTY(config, EditAnywhere, Category = "Routing", meta = (ClampMin = "1"))
+    int32 RouterCircuitFailureThreshold;
+
+    /** How long an open circuit keeps a backend out of rotation before a probe request may test it again */
+    UPROPERTY(config, EditAnywhere, Category = "Routing", meta = (ClampMin = "0.0", Units = "s"))
+    float RouterCircuitCooldownSeconds;
+
+    /** Hedge delay while a backend has too few samples for a p95 */
+    UPROPERTY(config, EditAnywhere, Category = "Routing", meta = (ClampMin = "0.0", Units = "s"))
+    float RouterDefaultHedgeDelaySeconds;
+
+    /** Lower bound of the hedge delay, keeps backends with a very low p95 from doubling the traffic */
+    UPROPERTY(config, EditAnywhere, Category = "Routing", meta = (ClampMin = "0.0", Units = "s"))
+    float RouterMinHedgeDelaySeconds;
+
+    int32 GetMaxConcurrentRequests(EGenAIOrgs Org) const;
+
+    // Provider API host without a trailing slash, the command line or settings override if one is set
+    FString GetBaseUrl(EGenAIOrgs Org) const;
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Data/Anthropic/GenClaudeChatStructs.h"
 #include "Engine/CancellableAsyncAction.h"
+#include "Network/GenRequestEngine.h"
 #include "UObject/Object.h"
 #include "GenClaudeChat.generated.h"
 
@@ -13,9 +14,15 @@
 // Delegate for C++ callbacks
 DECLARE_DELEGATE_ThreeParams(FOnClaudeChatCompletionResponse, const FString&, const FString&, bool);
 
+// Delegate for C++ callbacks, fired for every text delta while the response is being streamed
+DECLARE_DELEGATE_OneParam(FOnClaudeChatStreamDelta, const FString&);
+
 // Blueprint async delegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGenClaudeChatCompletionDelegate, const FString&, Response, const FString&, Error, bool, Success);
 
+// Blueprint async delegate for streamed text deltas
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGenClaudeChatStreamDelegate, const FString&, Delta);
+
 /**
  * 
  */
@@ -26,23 +33,30 @@ class GENERATIVEAISUPPORT_API UGenClaudeChat : public UCancellableAsyncAction
     
 public:
 	// Static function for native C++
-	static void SendChatRequest(const FGenClaudeChatSettings& ChatSettings, const FOnClaudeChatCompletionResponse& OnComplete);
+	static FGenRequestHandle SendChatRequest(const FGenClaudeChatSettings& ChatSettings, const FOnClaudeChatCompletionResponse& OnComplete);
+
+	// Static function for native C++, OnDelta fires for each text delta when ChatSettings.bStreamResponse is set,
+	// OnComplete still receives the fully assembled text at the end
+	static FGenRequestHandle SendChatRequest(const FGenClaudeChatSettings& ChatSettings, const FOnClaudeChatStreamDelta& OnDelta, const FOnClaudeChatCompletionResponse& OnComplete);
 
 	// Blueprint async function
 	UPROPERTY(BlueprintAssignable)
 	FGenClaudeChatCompletionDelegate OnComplete;
 
+	// Fires for each text delta while a streamed response (bStreamResponse) is arriving
+	UPROPERTY(BlueprintAssignable)
+	FGenClaudeChatStreamDelegate OnStreamDelta;
+
 	// Blueprint latent function
 	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GenAI|Claude")
 	static UGenClaudeChat* RequestClaudeChat(UObject* WorldContextObject, const FGenClaudeChatSettings& ChatSettings);
 
+	virtual void Cancel() override;
+
 private:
 	// Stores settings for request
 	FGenClaudeChatSettings ChatSettings;
-
-	// Internal request processing
-	static void MakeRequest(const FGenClaudeChatSettings& ChatSettings, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
-	static void ProcessResponse(const FString& ResponseStr, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
+	FGenRequestHandle RequestHandle;
 
 protected:
 	virtual void Activate() override;
@@ -4,16 +4,24 @@
 
 #include "CoreMinimal.h"
 #include "Data/GenAIOrgs.h"
+#include "Data/GenRequestOptions.h"
 #include "Engine/CancellableAsyncAction.h"
+#include "Network/GenRequestEngine.h"
 #include "GenDSeekChat.generated.h"
 
 struct FGenChatMessage;
 // Delegate for C++ callbacks
 DECLARE_DELEGATE_ThreeParams(FOnDSeekChatCompletionResponse, const FString&, const FString&, bool);
 
+// Delegate for C++ callbacks, fired for every streamed delta with the content and reasoning channels kept apart
+DECLARE_DELEGATE_TwoParams(FOnDSeekChatStreamDelta, const FString& /*Content*/, const FString& /*ReasoningContent*/);
+
 // Blueprint async delegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGenDSeekChatCompletionDelegate, const FString&, Response, const FString&, Error, bool, Success);
 
+// Blueprint async delegate for streamed deltas
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGenDSeekChatStreamDelegate, const FString&, Delta);
+
 // Chat settings structure
 USTRUCT(BlueprintType)
 struct FGenDSeekChatSettings
@@ -31,6 +39,10 @@ struct FGenDSeekChatSettings
 
 	UPROPERTY(BlueprintReadWrite, Category = "GenAI")
 	bool bStreamResponse = false;
+
+	// Caching and other per-request behaviour shared by all providers
+	UPROPERTY(BlueprintReadWrite, Category = "GenAI")
+	FGenRequestOptions RequestOptions;
 };
 
 
@@ -44,23 +56,36 @@ class GENERATIVEAISUPPORT_API UGenDSeekChat : public UCancellableAsyncAction
 	
 public:
 	// Static function for native C++
-	static void SendChatRequest(const FGenDSeekChatSettings& ChatSettings, const FOnDSeekChatCompletionResponse& OnComplete);
+	static FGenRequestHandle SendChatRequest(const FGenDSeekChatSettings& ChatSettings, const FOnDSeekChatCompletionResponse& OnComplete);
+
+	/**
+	 * Static function for native C++, OnDelta fires for each delta when ChatSettings.bStreamResponse is set.
+	 * When streaming, the reasoning of deepseek-reasoner only arrives through OnDelta and is not appended to the final response.
+	 */
+	static FGenRequestHandle SendChatRequest(const FGenDSeekChatSettings& ChatSettings, const FOnDSeekChatStreamDelta& OnDelta, const FOnDSeekChatCompletionResponse& OnComplete);
 
 	// Blueprint async function
 	UPROPERTY(BlueprintAssignable)
 	FGenDSeekChatCompletionDelegate OnComplete;
 
+	// Fires for each content delta while a streamed response (bStreamResponse) is arriving
+	UPROPERTY(BlueprintAssignable)
+	FGenDSeekChatStreamDelegate OnStreamDelta;
+
+	// Fires for each reasoning delta of deepseek-reasoner while a streamed response is arriving
+	UPROPERTY(BlueprintAssignable)
+	FGenDSeekChatStreamDelegate OnReasoningDelta;
+
 	// Blueprint latent function
 	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GenAI|DeepSeek")
 	static UGenDSeekChat* RequestDeepseekChat(UObject* WorldContextObject, const FGenDSeekChatSettings& ChatSettings);
 
+	virtual void Cancel() override;
+
 private:
 	// Stores settings for request
 	FGenDSeekChatSettings ChatSettings;
-
-	// Internal request processing
-	static void MakeRequest(const FGenDSeekChatSettings& ChatSettings, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
-	static void ProcessResponse(const FString& ResponseStr, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
+	FGenRequestHandle RequestHandle;
 
 protected:
 	virtual void Activate() override;
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/CancellableAsyncAction.h"
+#include "Network/GenProviderRouter.h"
+#include "GenRoutedChat.generated.h"
+
+// Delegate for C++ callbacks
+DECLARE_DELEGATE_ThreeParams(FOnRoutedChatCompletionResponse, const FString&, const FString&, bool);
+
+// Delegate for C++ callbacks, fired for every content delta of the backend that answered first
+DECLARE_DELEGATE_OneParam(FOnRoutedChatStreamDelta, const FString&);
+
+// Blueprint async delegate
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGenRoutedChatCompletionDelegate, const FString&, Response, const FString&, Error, bool, Success);
+
+// Blueprint async delegate for streamed content deltas
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGenRoutedChatStreamDelegate, const FString&, Delta);
+
+/**
+ * Chat request sent through FGenProviderRouter to the fastest healthy of several providers
+ */
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenRoutedChat : public UCancellableAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+	// Static function for native C++
+	static FGenRoutedRequestHandle SendChatRequest(const FGenRoutedChatSettings& ChatSettings, const FOnRoutedChatCompletionResponse& OnComplete);
+
+	// Static function for native C++, OnDelta fires for each content delta when ChatSettings.bStreamResponse is set
+	static FGenRoutedRequestHandle SendChatRequest(const FGenRoutedChatSettings& ChatSettings, const FOnRoutedChatStreamDelta& OnDelta,
+	                                               const FOnRoutedChatCompletionResponse& OnComplete);
+
+	// Blueprint async function
+	UPROPERTY(BlueprintAssignable)
+	FGenRoutedChatCompletionDelegate OnComplete;
+
+	// Fires for each content delta while a streamed response (bStreamResponse) is arriving
+	UPROPERTY(BlueprintAssignable)
+	FGenRoutedChatStreamDelegate OnStreamDelta;
+
+	// Blueprint latent function
+	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GenAI|Router")
+	static UGenRoutedChat* RequestRoutedChat(UObject* WorldContextObject, const FGenRoutedChatSettings& ChatSettings);
+
+	virtual void Cancel() override;
+
+private:
+	// Stores settings for request
+	FGenRoutedChatSettings ChatSettings;
+	FGenRoutedRequestHandle RequestHandle;
+
+protected:
+	virtual void Activate() override;
+};
@@ -3,11 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Data/GenChatConversation.h"
 #include "Data/OpenAI/GenOAIChatStructs.h"
 #include "Data/OpenAI/GenOAIModels.h"
 #include "Engine/CancellableAsyncAction.h"
-#include "Interfaces/IHttpRequest.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
+#include "Network/GenRequestEngine.h"
 #include "GenOAIChat.generated.h"
 
 
@@ -17,35 +18,56 @@
 // this does however remove the functionality of unreal reflection system, but we don't need that here, as the blueprint latent function will handle that
 DECLARE_DELEGATE_ThreeParams(FOnChatCompletionResponse, const FString&, const FString&, bool);
 
+// C++ delegate fired for every content delta of a streamed response
+DECLARE_DELEGATE_OneParam(FOnChatStreamDelta, const FString&);
+
 // Blueprint async delegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGenChatCompletionDelegate, const FString&, Response, const FString&, Error, bool, Success);
 
+// Blueprint async delegate for streamed content deltas
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGenChatStreamDelegate, const FString&, Delta);
+
 UCLASS()
 class GENERATIVEAISUPPORT_API UGenOAIChat : public UCancellableAsyncAction
 {
     GENERATED_BODY()
 
 public:
-    // Static function for native C++
-    static TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> SendChatRequest(const FGenChatSettings& ChatSettings, const FOnChatCompletionResponse& OnComplete);
+    // Static function for native C++, identical concurrent requests share one round trip (see FGenRequestOptions)
+    static FGenRequestHandle SendChatRequest(const FGenChatSettings& ChatSettings, const FOnChatCompletionResponse& OnComplete);
+
+    // Static function for native C++, OnDelta fires for each content delta when ChatSettings.bStreamResponse is set
+    static FGenRequestHandle SendChatRequest(const FGenChatSettings& ChatSettings, const FOnChatStreamDelta& OnDelta, const FOnChatCompletionResponse& OnComplete);
 
     // Blueprint-callable function
     UPROPERTY(BlueprintAssignable)
     FGenChatCompletionDelegate OnComplete;
 
+    // Fires for each content delta while a streamed response (bStreamResponse) is arriving
+    UPROPERTY(BlueprintAssignable)
+    FGenChatStreamDelegate OnStreamDelta;
+
     // Blueprint latent function
     UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GenAI")
     static UGenOAIChat* RequestOpenAIChat(UObject* WorldContextObject, const FGenChatSettings& ChatSettings);
+
+    // Sends Conversation and UserMessage ahead of ChatSettings.Messages, both UserMessage and the reply are added to
+    // Conversation once the reply arrived, a failed or cancelled request leaves Conversation untouched
+    UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GenAI")
+    static UGenOAIChat* RequestOpenAIConversationChat(UObject* WorldContextObject, UGenChatConversation* Conversation, const FString& UserMessage,
+                                                      const FGenChatSettings& ChatSettings);
     
     virtual void Cancel() override;
 
 private:
     FGenChatSettings ChatSettings;
-    TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+    FGenRequestHandle RequestHandle;
+
+    UPROPERTY()
+    TObjectPtr<UGenChatConversation> Conversation;
 
-    // Shared implementation
-    static TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> MakeRequest(const FGenChatSettings& ChatSettings, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
-    static void ProcessResponse(const FString& ResponseStr, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
+    // Sent after Conversation, only committed to it together with the reply
+    FString UserMessage;
 
 protected:
     virtual void Activate() override;
@@ -5,13 +5,18 @@
 #include "CoreMinimal.h"
 #include "Data/OpenAI/GenOAIChatStructs.h"
 #include "Engine/CancellableAsyncAction.h"
+#include "Network/GenRequestEngine.h"
+#include "Utilities/GenJsonStreamParser.h"
+#include "Utilities/GenStructDecoder.h"
 #include "GenOAIStructuredOpService.generated.h"
 
 // Static delegate for native C++ usage
 DECLARE_DELEGATE_ThreeParams(FOnSchemaResponse, const FString&, const FString&, bool);
+DECLARE_DELEGATE_OneParam(FOnSchemaValue, const FGenJsonStreamEvent&);
 
 // Blueprint async delegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGenSchemaResponseDelegate, const FString&, Response, const FString&, Error, bool, Success);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGenSchemaValueDelegate, const FString&, Field, int32, Index, const FString&, Json);
 
 
 /**
@@ -24,24 +29,53 @@ class GENERATIVEAISUPPORT_API UGenOAIStructuredOpService : public UCancellableAs
 
 public:
 	// Static function for native C++
-	static void RequestStructuredOutput(const FGenOAIStructuredChatSettings& StructuredChatSettings, const FOnSchemaResponse& OnComplete);
+	static FGenRequestHandle RequestStructuredOutput(const FGenOAIStructuredChatSettings& StructuredChatSettings, const FOnSchemaResponse& OnComplete);
+
+	// OnValue fires for each top level field, and each element of a top level array, as soon as it is complete.
+	// With ChatSettings.bStreamResponse that happens while the rest is still being generated, otherwise right before OnComplete
+	static FGenRequestHandle RequestStructuredOutput(const FGenOAIStructuredChatSettings& StructuredChatSettings, const FOnSchemaValue& OnValue, const FOnSchemaResponse& OnComplete);
+
+	// Decodes the response straight into TStruct, whose schema is sent unless the settings already name one
+	template <typename TStruct>
+	static FGenRequestHandle RequestStructuredOutput(FGenOAIStructuredChatSettings StructuredChatSettings, TFunction<void(const TStruct& Value, const FString& Error, bool Success)> OnComplete)
+	{
+		if (!StructuredChatSettings.SchemaStruct && StructuredChatSettings.SchemaName.IsNone() && StructuredChatSettings.SchemaJson.IsEmpty())
+		{
+			StructuredChatSettings.SchemaStruct = TStruct::StaticStruct();
+		}
+		return RequestStructuredOutput(StructuredChatSettings, FOnSchemaResponse::CreateLambda(
+			[OnComplete = MoveTemp(OnComplete)](const FString& Response, const FString& Error, bool Success)
+			{
+				TStruct Value;
+				FString DecodeError;
+				if (Success && !FGenStructDecoder::Decode(Response, Value, &DecodeError))
+				{
+					OnComplete(Value, DecodeError, false);
+					return;
+				}
+				OnComplete(Value, Error, Success);
+			}));
+	}
 
 	// Blueprint async function
 	UPROPERTY(BlueprintAssignable)
 	FGenSchemaResponseDelegate OnComplete;
 
+	// Index is -1 when Json holds a whole top level field rather than one element of it
+	UPROPERTY(BlueprintAssignable)
+	FGenSchemaValueDelegate OnValueComplete;
+
 	// Blueprint latent function
 	UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GenAI")
 	static UGenOAIStructuredOpService* RequestOpenAIStructuredOutput(UObject* WorldContextObject, const FGenOAIStructuredChatSettings& StructuredChatSettings);
 
+	virtual void Cancel() override;
+
 private:
 	FString Prompt;
 	FString SchemaJson;
 	FGenOAIStructuredChatSettings StructuredChatSettings;
-
-	static void MakeRequest(const FGenOAIStructuredChatSettings& StructuredChatSettings, const TFunction<void(const FString&, const FString&, bool)
-	                        >& ResponseCallback);
-	static void ProcessResponse(const FString& ResponseStr, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
+	FGenRequestHandle RequestHandle;
 
 protected:
 	virtual void Activate() override;
@@ -5,14 +5,21 @@
 #include "CoreMinimal.h"
 #include "Data/XAI/GenXAIChatStructs.h"
 #include "Engine/CancellableAsyncAction.h"
+#include "Network/GenRequestEngine.h"
 #include "GenXAIChat.generated.h"
 
 // Regular C++ delegate for native code
 DECLARE_DELEGATE_ThreeParams(FOnXAIChatCompletionResponse, const FString&, const FString&, bool);
 
+// Regular C++ delegate fired for every content delta of a streamed response
+DECLARE_DELEGATE_OneParam(FOnXAIChatStreamDelta, const FString&);
+
 // Blueprint async delegate
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGenXAIChatCompletionDelegate, const FString&, Response, const FString&, Error, bool, Success);
 
+// Blueprint async delegate for streamed content deltas
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGenXAIChatStreamDelegate, const FString&, Delta);
+
 UCLASS()
 class GENERATIVEAISUPPORT_API UGenXAIChat : public UCancellableAsyncAction
 {
@@ -20,22 +27,28 @@ class GENERATIVEAISUPPORT_API UGenXAIChat : public UCancellableAsyncAction
 
 public:
     // Static function for native C++
-    static void SendChatRequest(const FGenXAIChatSettings& ChatSettings, const FOnXAIChatCompletionResponse& OnComplete);
+    static FGenRequestHandle SendChatRequest(const FGenXAIChatSettings& ChatSettings, const FOnXAIChatCompletionResponse& OnComplete);
+
+    // Static function for native C++, OnDelta fires for each content delta when ChatSettings.bStreamResponse is set
+    static FGenRequestHandle SendChatRequest(const FGenXAIChatSettings& ChatSettings, const FOnXAIChatStreamDelta& OnDelta, const FOnXAIChatCompletionResponse& OnComplete);
 
     // Blueprint-callable function
     UPROPERTY(BlueprintAssignable)
     FGenXAIChatCompletionDelegate OnComplete;
 
+    // Fires for each content delta while a streamed response (bStreamResponse) is arriving
+    UPROPERTY(BlueprintAssignable)
+    FGenXAIChatStreamDelegate OnStreamDelta;
+
     // Blueprint latent function
     UFUNCTION(BlueprintCallable, meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"), Category = "GenAI")
     static UGenXAIChat* RequestXAIChat(UObject* WorldContextObject, const FGenXAIChatSettings& ChatSettings);
 
+    virtual void Cancel() override;
+
 private:
     FGenXAIChatSettings ChatSettings;
-
-    // Shared implementation
-    static void MakeRequest(const FGenXAIChatSettings& ChatSettings, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
-    static void ProcessResponse(const FString& ResponseStr, const TFunction<void(const FString&, const FString&, bool)>& ResponseCallback);
+    FGenRequestHandle RequestHandle;
 
 protected:
     virtual void Activate() override;
@@ -0,0 +1,205 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Data/Anthropic/GenClaudeChatStructs.h"
+#include "Data/GenAIOrgs.h"
+#include "Data/OpenAI/GenOAIChatStructs.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "GenBatchJobSubsystem.generated.h"
+
+UENUM(BlueprintType)
+enum class EGenBatchJobStatus : uint8
+{
+	// Payload is being uploaded / the batch created
+	Submitting,
+	// Accepted by the provider, polled until it ends
+	InProgress,
+	// Ended, results are being downloaded and delivered
+	Collecting,
+	Completed,
+	Failed,
+	Cancelled,
+	Expired
+};
+
+/**
+ * One batch job, persisted to Saved/GenAI/BatchJobs.json so result collection resumes after a restart
+ */
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenBatchJobInfo
+{
+	GENERATED_BODY()
+
+	// Local id handed out by SubmitOpenAIChatBatch / SubmitClaudeChatBatch
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	FString JobId;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	EGenAIOrgs Org = EGenAIOrgs::Unknown;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	EGenBatchJobStatus Status = EGenBatchJobStatus::Submitting;
+
+	// The provider's batch id
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	FString ProviderBatchId;
+
+	// Last status reported by the provider ("in_progress", "completed", "ended", ...)
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	FString ProviderStatus;
+
+	// OpenAI output file id or Anthropic results_url, set once the batch ended
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	FString ResultLocation;
+
+	// OpenAI only, failed requests are reported in a separate file
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	FString ErrorLocation;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	int32 NumItems = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	int32 NumSucceeded = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	int32 NumFailed = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	FDateTime SubmittedAt;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Batch")
+	FString Error;
+
+	UPROPERTY()
+	bool bCancelRequested = false;
+
+	// The output file went out through OnItemResult, a retried collection only fetches the error file
+	UPROPERTY()
+	bool bResultsDelivered = false;
+
+	bool IsFinished() const
+	{
+		return Status == EGenBatchJobStatus::Completed || Status == EGenBatchJobStatus::Failed
+			|| Status == EGenBatchJobStatus::Cancelled || Status == EGenBatchJobStatus::Expired;
+	}
+};
+
+// Native per item result: ItemIndex into the submitted array, Response, Error, Success
+DECLARE_DELEGATE_FourParams(FOnGenBatchItemResult, int32, const FString&, const FString&, bool);
+
+// Native job completion, fired once the job reached a final status and every result was delivered
+DECLARE_DELEGATE_OneParam(FOnGenBatchJobFinished, const FGenBatchJobInfo&);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FGenBatchItemResultDelegate, const FString&, JobId, int32, ItemIndex, const FString&, Response, const FString&, Error, bool, Success);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGenBatchJobFinishedDelegate, const FGenBatchJobInfo&, Job);
+
+/**
+ * Bulk offline generation through the providers' batch APIs (OpenAI /v1/batches, Anthropic Message Batches).
+ * Batches are priced at half the synchronous rate and have their own rate limits, results arrive within 24 hours.
+ *
+ * Items are identified by their index in the submitted array. Per item delegates only live as long as the process,
+ * after a restart collection resumes and results are reported through OnItemResult only.
+ * A job interrupted while its results were being delivered delivers all of them again.
+ * Game thread only.
+ */
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenBatchJobSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Returns the job id, streaming is ignored for batched requests
+	FString SubmitOpenAIChatBatch(const TArray<FGenChatSettings>& Items, const FOnGenBatchItemResult& OnItemResult,
+	                              const FOnGenBatchJobFinished& OnFinished = FOnGenBatchJobFinished());
+
+	// Returns the job id, streaming is ignored for batched requests
+	FString SubmitClaudeChatBatch(const TArray<FGenClaudeChatSettings>& Items, const FOnGenBatchItemResult& OnItemResult,
+	                              const FOnGenBatchJobFinished& OnFinished = FOnGenBatchJobFinished());
+
+	// Blueprint variant, results arrive through OnItemResult / OnJobFinished
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Batch", meta = (DisplayName = "Submit OpenAI Chat Batch"))
+	FString RequestOpenAIChatBatch(const TArray<FGenChatSettings>& Items);
+
+	// Blueprint variant, results arrive through OnItemResult / OnJobFinished
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Batch", meta = (DisplayName = "Submit Claude Chat Batch"))
+	FString RequestClaudeChatBatch(const TArray<FGenClaudeChatSettings>& Items);
+
+	// Asks the provider to stop the batch, results of requests that already finished are still delivered
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Batch")
+	void CancelJob(const FString& JobId);
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Batch")
+	bool GetJob(const FString& JobId, FGenBatchJobInfo& OutJob) const;
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Batch")
+	TArray<FGenBatchJobInfo> GetJobs() const { return Jobs; }
+
+	// Drops finished jobs from the persisted list
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Batch")
+	void RemoveFinishedJobs();
+
+	// Fired for every item result of every job, including jobs resumed after a restart
+	UPROPERTY(BlueprintAssignable, Category = "GenAI|Batch")
+	FGenBatchItemResultDelegate OnItemResult;
+
+	UPROPERTY(BlueprintAssignable, Category = "GenAI|Batch")
+	FGenBatchJobFinishedDelegate OnJobFinished;
+
+private:
+	struct FJobCallbacks
+	{
+		FOnGenBatchItemResult OnItemResult;
+		FOnGenBatchJobFinished OnFinished;
+	};
+
+	// Registers a job in the Submitting state, returns its id
+	FString AddJob(EGenAIOrgs Org, int32 NumItems, const FOnGenBatchItemResult& OnItemResult, const FOnGenBatchJobFinished& OnFinished);
+	FGenBatchJobInfo* FindJob(const FString& JobId);
+
+	// UrlOrPath is either absolute or relative to the provider's base URL
+	static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest(EGenAIOrgs Org, const FString& Verb, const FString& UrlOrPath);
+
+	void UploadOpenAIBatchFile(const FString& JobId, TArray<uint8>&& Lines);
+	void CreateOpenAIBatch(const FString& JobId, const FString& InputFileId);
+	void CreateClaudeBatch(const FString& JobId, TArray<uint8>&& Payload);
+
+	// Sends a status request or batch creation and feeds the returned batch object to ApplyStatus
+	void SendBatchRequest(const FString& JobId, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, bool bFailOnError);
+
+	bool Tick(float DeltaTime);
+	void Poll(const FGenBatchJobInfo& Job);
+	void SendCancel(const FGenBatchJobInfo& Job);
+	void ApplyStatus(const FString& JobId, TConstArrayView<uint8> BatchJson);
+
+	// Downloads the results and delivers them line by line, then moves on to the error file / finishes the job
+	void Collect(const FString& JobId, bool bErrorFile);
+	void DeliverResultLines(const FString& JobId, TConstArrayView<uint8> Lines);
+	void DeliverResult(const FString& JobId, int32 ItemIndex, const FString& Response, const FString& Error, bool bSuccess);
+
+	// Sets the final status, persists it and fires the completion delegates
+	void Finish(const FString& JobId, EGenBatchJobStatus Status, const FString& Error = FString());
+
+	// Finish for failures found while submitting, the delegates fire once the caller has the job id
+	void FinishNextTick(const FString& JobId, EGenBatchJobStatus Status, const FString& Error);
+
+	void LoadJobs();
+	void SaveJobs() const;
+
+	TArray<FGenBatchJobInfo> Jobs;
+	TMap<FString, FJobCallbacks> Callbacks;
+
+	// Jobs with a status request or download in flight, so a slow provider does not pile up polls
+	TSet<FString> BusyJobs;
+
+	FTSTicker::FDelegateHandle TickHandle;
+};
@@ -0,0 +1,131 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GenCassette.generated.h"
+
+UENUM(BlueprintType)
+enum class EGenCassetteMode : uint8
+{
+	Off,
+	// Every provider response is captured, with the arrival times of its chunks
+	Record,
+	// Requests are answered from the cassette instead of the network
+	Replay
+};
+
+/**
+ * Part of a response body that had arrived by then, offsets are into FGenCassetteEntry::Body
+ */
+struct FGenCassetteChunk
+{
+	float Seconds = 0.0f;
+	int32 EndOffset = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FGenCassetteChunk& Chunk)
+	{
+		return Ar << Chunk.Seconds << Chunk.EndOffset;
+	}
+};
+
+/**
+ * One provider response as it came off the wire, times are seconds since the request was sent
+ */
+struct GENERATIVEAISUPPORT_API FGenCassetteEntry
+{
+	// FGenResponseCache::ComputeKey of endpoint and payload
+	FString Key;
+	FString Provider;
+	FString Model;
+
+	// False when no response arrived at all (connection failure, timeout)
+	bool bReceived = false;
+	int32 ResponseCode = 0;
+	bool bStream = false;
+
+	float FirstByteSeconds = 0.0f;
+	float TotalSeconds = 0.0f;
+
+	// Response body as received, compressed if it was
+	TArray<uint8> Body;
+	TArray<FGenCassetteChunk> Chunks;
+
+	friend FArchive& operator<<(FArchive& Ar, FGenCassetteEntry& Entry);
+};
+
+/**
+ * Record / replay of provider traffic. Recording captures every response the request engine receives, streamed chunk
+ * timing included, into a zlib compressed cassette under Saved/GenAI/Cassettes. Replaying answers requests with the same
+ * endpoint and payload from the cassette, through the same stream decoding, parsing and delegate paths, either at the
+ * recorded pace (Speed 1, 2 for twice as fast...) or flat out (Speed 0). Identical requests replay their recordings in order.
+ * From the console: "GenAI.Cassette record <Name>", "GenAI.Cassette replay <Name> [Speed] [passthrough]", "GenAI.Cassette stop".
+ * On the command line: -GenAICassetteRecord=<Name> or -GenAICassetteReplay=<Name> [-GenAICassetteSpeed=<Speed>].
+ * Game thread only.
+ */
+class GENERATIVEAISUPPORT_API FGenCassette
+{
+public:
+	static FGenCassette& Get();
+
+	// Saved/GenAI/Cassettes/<Name>.gencassette, paths are taken as they are
+	static FString GetCassettePath(const FString& NameOrPath);
+
+	bool StartRecording(const FString& NameOrPath);
+
+	// Passthrough sends requests missing from the cassette to the provider instead of failing them
+	bool StartReplay(const FString& NameOrPath, float Speed = 0.0f, bool bPassthrough = false);
+
+	// Writes the cassette when recording
+	void Stop();
+
+	EGenCassetteMode GetMode() const { return Mode; }
+	float GetReplaySpeed() const { return ReplaySpeed; }
+	bool IsPassthrough() const { return bPassthrough; }
+
+	void Record(FGenCassetteEntry&& Entry);
+
+	// Next recording for the key, wrapping around once all of them were replayed
+	TSharedPtr<const FGenCassetteEntry> FindReplay(const FString& Key);
+
+private:
+	FGenCassette();
+
+	bool Save() const;
+	bool Load(const FString& Path);
+
+	EGenCassetteMode Mode = EGenCassetteMode::Off;
+	FString Path;
+	float ReplaySpeed = 0.0f;
+	bool bPassthrough = false;
+
+	// Recordings per key in the order they were made, Order keeps the file in recording order
+	TMap<FString, TArray<TSharedRef<const FGenCassetteEntry>>> Entries;
+	TArray<TSharedRef<const FGenCassetteEntry>> Order;
+	TMap<FString, int32> ReplayCursors;
+	int32 Misses = 0;
+};
+
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenCassetteLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// A bare name goes to Saved/GenAI/Cassettes/<Name>.gencassette
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Cassette")
+	static bool StartCassetteRecording(const FString& NameOrPath);
+
+	// Speed 1 replays at the recorded pace, 0 as fast as possible
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Cassette")
+	static bool StartCassetteReplay(const FString& NameOrPath, float Speed = 0.0f, bool bPassthrough = false);
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Cassette")
+	static void StopCassette();
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Cassette")
+	static EGenCassetteMode GetCassetteMode();
+};
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/GenAIOrgs.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GenCompression.generated.h"
+
+struct z_stream_s;
+
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenCompressionStats
+{
+	GENERATED_BODY()
+
+	// Request bodies before and after compression, uncompressed requests count into both
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Compression")
+	int64 RequestBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Compression")
+	int64 RequestWireBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Compression")
+	int64 CompressedRequests = 0;
+
+	// Response bodies as received and after inflating
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Compression")
+	int64 ResponseWireBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Compression")
+	int64 ResponseBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Compression")
+	int64 CompressedResponses = 0;
+
+	// Wire bytes per uncompressed byte, 1 when nothing was compressed
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Compression")
+	float RequestRatio = 1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Compression")
+	float ResponseRatio = 1.0f;
+};
+
+/**
+ * Incremental gzip / zlib decoder for response bodies that arrive in chunks, the format is detected from the header
+ */
+class GENERATIVEAISUPPORT_API FGenStreamInflater
+{
+public:
+	FGenStreamInflater();
+	~FGenStreamInflater();
+
+	FGenStreamInflater(const FGenStreamInflater&) = delete;
+	FGenStreamInflater& operator=(const FGenStreamInflater&) = delete;
+
+	// Replaces OutData with everything Data decodes to, false once the stream turned out to be corrupt
+	bool Inflate(const uint8* Data, int64 Num, TArray<uint8>& OutData);
+
+	int64 GetTotalOut() const { return TotalOut; }
+
+private:
+	z_stream_s* Stream = nullptr;
+	bool bFailed = false;
+	// Trailing bytes after the gzip member are ignored
+	bool bStreamEnded = false;
+	int64 TotalOut = 0;
+};
+
+/**
+ * gzip for request and response bodies, plus the byte counters behind FGenCompressionStats.
+ * Request bodies are only compressed for providers listed in UGenerativeAISupportRuntimeSettings::CompressRequestProviders,
+ * most public endpoints do not accept a Content-Encoding on requests.
+ */
+class GENERATIVEAISUPPORT_API FGenCompression
+{
+public:
+	static bool ShouldCompressRequest(EGenAIOrgs Org, int32 NumBytes);
+
+	static bool GzipCompress(TConstArrayView<uint8> Data, TArray<uint8>& OutCompressed);
+
+	// Checks the gzip magic bytes, a JSON or SSE body never starts with them
+	static bool IsGzip(TConstArrayView<uint8> Data);
+
+	static bool Inflate(TConstArrayView<uint8> Data, TArray<uint8>& OutData);
+
+	static void RecordRequest(int64 Bytes, int64 WireBytes);
+	static void RecordResponse(int64 WireBytes, int64 Bytes);
+
+	static FGenCompressionStats GetStats();
+	static void ResetStats();
+};
+
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenCompressionLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Compression")
+	static FGenCompressionStats GetCompressionStats();
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Compression")
+	static void ResetCompressionStats();
+};
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Data/GenAIOrgs.h"
+
+/**
+ * Keeps a connection to every provider host listed in UGenerativeAISupportRuntimeSettings::WarmConnectionProviders open,
+ * so the first chat request after startup or a level load does not pay DNS, TCP and TLS setup on top of model latency.
+ * Pooling itself is the HTTP backend's job (libcurl keeps idle connections per host and multiplexes HTTP/2 where the server
+ * negotiated it), the warmer only makes sure there is a live connection in that pool by pinging the host with HEAD requests.
+ * Started by FGenerativeAISupportModule. Game thread only.
+ */
+class GENERATIVEAISUPPORT_API FGenConnectionWarmer
+{
+public:
+	static FGenConnectionWarmer& Get();
+
+	void Start();
+	void Stop();
+
+	// Pings every configured provider that has an API key, e.g. after a level load stalled the keep-alive ticker
+	void WarmAll();
+
+private:
+	struct FHostState
+	{
+		double LastPingTime = -1.0;
+		// Duration of the very first ping, which had to set up the connection
+		double ColdPingMs = -1.0;
+		bool bSavingsReported = false;
+		bool bPingInFlight = false;
+	};
+
+	bool Tick(float DeltaTime);
+	void Ping(EGenAIOrgs Org);
+
+	TMap<EGenAIOrgs, FHostState> Hosts;
+	FTSTicker::FDelegateHandle TickHandle;
+	FDelegateHandle PostLoadMapHandle;
+};
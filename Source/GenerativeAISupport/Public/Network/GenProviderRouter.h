@@ -0,0 +1,219 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/GenAIOrgs.h"
+#include "Data/GenRequestOptions.h"
+#include "Data/OpenAI/GenOAIChatStructs.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Network/GenRequestEngine.h"
+#include "Network/GenRequestTypes.h"
+#include "GenProviderRouter.generated.h"
+
+// One provider and model a routed request may be sent to
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenRouteBackend
+{
+	GENERATED_BODY()
+
+	// OpenAI, Anthropic, DeepSeek and XAI are supported
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router")
+	EGenAIOrgs Org = EGenAIOrgs::OpenAI;
+
+	// Model name as the provider spells it, e.g. "gpt-4.1-mini" or "claude-3-5-haiku-latest"
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router")
+	FString Model = TEXT("gpt-4o-mini");
+
+	bool operator==(const FGenRouteBackend& Other) const { return Org == Other.Org && Model == Other.Model; }
+};
+
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenRoutedChatSettings
+{
+	GENERATED_BODY()
+
+	// Candidates in order of preference, which only decides between backends that have not been measured yet or are equally fast
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router")
+	TArray<FGenRouteBackend> Backends;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router")
+	TArray<FGenChatMessage> Messages;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router")
+	int32 MaxTokens = 1024;
+
+	// The first backend to stream a delta wins, the others are cancelled
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router")
+	bool bStreamResponse = false;
+
+	// Sends a duplicate to the next best backend when the first one is slower than usual, the first answer wins
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router")
+	bool bHedge = true;
+
+	// Wait before hedging, 0 uses the p95 latency observed for the first backend
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router", meta = (ClampMin = "0.0", Units = "s", EditCondition = "bHedge"))
+	float HedgeDelaySeconds = 0.0f;
+
+	// Backends tried at most, hedges and failovers included
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router", meta = (ClampMin = "1"))
+	int32 MaxAttempts = 3;
+
+	// Retries are only made on the last backend, every other one fails over instead,
+	// the deadline and cancellation token cover the routed request with all of its attempts
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GenAI|Router")
+	FGenRequestOptions RequestOptions;
+};
+
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenBackendHealth
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	FGenRouteBackend Backend;
+
+	// Completed attempts, cancelled ones are not counted
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	int64 Requests = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	int64 Failures = 0;
+
+	// Exponentially weighted moving averages
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	float LatencySeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	float ErrorRate = 0.0f;
+
+	// Over the last 64 successful attempts
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	float P95LatencySeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	int64 HedgesStarted = 0;
+
+	// Hedges that answered before the backend they were hedging
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	int64 HedgesWon = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Router")
+	bool bCircuitOpen = false;
+};
+
+struct FGenRoutedRequest;
+
+/**
+ * Caller side of a routed request, cancelling it cancels every attempt still in flight
+ */
+class GENERATIVEAISUPPORT_API FGenRoutedRequestHandle
+{
+public:
+	FGenRoutedRequestHandle() = default;
+	explicit FGenRoutedRequestHandle(const TSharedRef<FGenRoutedRequest>& InRequest) : Request(InRequest) {}
+
+	void Cancel();
+	bool IsPending() const;
+
+private:
+	TWeakPtr<FGenRoutedRequest> Request;
+};
+
+/**
+ * Sends chat requests to whichever of several provider backends currently answers fastest.
+ *
+ * Every backend (provider and model) keeps an EWMA of its latency and error rate and a window of recent latencies.
+ * A request goes to the backend with the lowest expected time to a successful answer, latency divided by success rate.
+ * If it has not answered after its p95 latency a hedge goes to the next best backend, the first answer wins and the
+ * other attempt is cancelled. Failed attempts fail over to the next backend. Consecutive failures open a backend's
+ * circuit breaker, it gets no traffic until a single probe request succeeds after the cooldown.
+ * Game thread only.
+ */
+class GENERATIVEAISUPPORT_API FGenProviderRouter
+{
+public:
+	static FGenProviderRouter& Get();
+
+	// ResponseCallback is invoked exactly once unless the handle is cancelled first, like TGenRequestEngine::Send
+	FGenRoutedRequestHandle Send(const FGenRoutedChatSettings& Settings, FGenResponseCallback ResponseCallback, FGenDeltaCallback DeltaCallback = nullptr);
+
+	TArray<FGenBackendHealth> GetHealth() const;
+	void ResetHealth();
+
+private:
+	friend class FGenRoutedRequestHandle;
+
+	enum class ECircuitState : uint8
+	{
+		Closed,
+		Open,
+		// Cooldown over, one probe request decides whether it closes again
+		HalfOpen
+	};
+
+	struct FBackendState
+	{
+		double LatencyEwma = 0.0;
+		double ErrorRate = 0.0;
+		TArray<float> RecentLatencies;
+		int32 NextLatencySlot = 0;
+
+		int64 Requests = 0;
+		int64 Failures = 0;
+		int64 HedgesStarted = 0;
+		int64 HedgesWon = 0;
+
+		ECircuitState Circuit = ECircuitState::Closed;
+		int32 ConsecutiveFailures = 0;
+		double OpenUntil = 0.0;
+		bool bProbeInFlight = false;
+
+		void AddLatency(double Seconds);
+		double GetP95Latency() const;
+	};
+
+	using FBackendKey = TPair<EGenAIOrgs, FString>;
+
+	FGenProviderRouter() = default;
+
+	static FBackendKey MakeKey(const FGenRouteBackend& Backend) { return FBackendKey(Backend.Org, Backend.Model); }
+
+	// Backends that may take traffic now, best first
+	TArray<FGenRouteBackend> RankBackends(TConstArrayView<FGenRouteBackend> Backends, double Now);
+	bool IsAvailable(FBackendState& State, double Now);
+
+	void StartAttempt(const TSharedRef<FGenRoutedRequest>& Request, bool bHedge);
+	void ArmHedge(const TSharedRef<FGenRoutedRequest>& Request);
+	void OnAttemptDelta(const TSharedRef<FGenRoutedRequest>& Request, int32 AttemptIndex, const FGenChatStreamDelta& Delta);
+	void OnAttemptComplete(const TSharedRef<FGenRoutedRequest>& Request, int32 AttemptIndex, const FString& Response, const FString& Error, bool bSuccess);
+
+	// Cancels every attempt in flight but Winner, INDEX_NONE cancels all, losers add their elapsed time as a latency sample
+	void CancelAttempts(FGenRoutedRequest& Request, int32 Winner, bool bRecordLatency);
+	void Finish(const TSharedRef<FGenRoutedRequest>& Request, const FString& Response, const FString& Error, bool bSuccess);
+
+	// Deadline passed or token cancelled, every attempt in flight is cancelled and the caller gets Error
+	void Abort(const TWeakPtr<FGenRoutedRequest>& WeakRequest, const FString& Error);
+
+	void RecordResult(const FGenRouteBackend& Backend, double LatencySeconds, bool bSuccess);
+
+	static FGenRequestHandle SendToBackend(const FGenRouteBackend& Backend, const FGenRoutedChatSettings& Settings, bool bLastBackend,
+	                                       FGenResponseCallback ResponseCallback, FGenDeltaCallback DeltaCallback);
+
+	TMap<FBackendKey, FBackendState> States;
+};
+
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenProviderRouterLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Router")
+	static TArray<FGenBackendHealth> GetBackendHealth();
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Router")
+	static void ResetBackendHealth();
+};
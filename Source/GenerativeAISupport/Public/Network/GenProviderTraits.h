@@ -0,0 +1,122 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/Anthropic/GenClaudeChatStructs.h"
+#include "Data/GenAIOrgs.h"
+#include "Data/OpenAI/GenOAIChatStructs.h"
+#include "Data/XAI/GenXAIChatStructs.h"
+#include "Models/DeepSeek/GenDSeekChat.h"
+#include "Network/GenRequestTypes.h"
+
+class IHttpRequest;
+struct FGenSSEEvent;
+
+/**
+ * Provider traits consumed by TGenRequestEngine, one struct per provider endpoint.
+ * Adding a provider means adding a traits struct here, see TGenRequestEngine for the required members.
+ * Responses and stream events are read with FGenJsonPullReader straight from the UTF-8 body, only the fields
+ * a provider needs get decoded.
+ */
+
+/**
+ * Shared behaviour of every provider speaking the OpenAI chat/completions wire format:
+ * bearer auth, choices[0].message.content responses and "data: {chunk}" streams ending in [DONE].
+ */
+struct GENERATIVEAISUPPORT_API FGenChatCompletionsTraits
+{
+	static void SetAuthHeaders(IHttpRequest& HttpRequest, const FString& ApiKey);
+	static FGenParsedResponse ParseResponse(TConstArrayView<uint8> ResponseJson);
+	static void HandleStreamEvent(const FGenSSEEvent& Event, FGenStreamState& State, FGenChatStreamDelta& OutDelta);
+};
+
+struct GENERATIVEAISUPPORT_API FGenOpenAIChatTraits : FGenChatCompletionsTraits
+{
+	using FSettings = FGenChatSettings;
+	static constexpr EGenAIOrgs Org = EGenAIOrgs::OpenAI;
+	static constexpr const TCHAR* ProviderName = TEXT("OpenAI");
+	static constexpr float TimeoutSeconds = 0.0f;
+
+	static FString GetEndpoint(const FSettings& Settings);
+	static FString GetModel(const FSettings& Settings);
+	static bool BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError);
+	static bool IsStreaming(const FSettings& Settings) { return Settings.bStreamResponse; }
+	static const FGenRequestOptions& GetRequestOptions(const FSettings& Settings) { return Settings.RequestOptions; }
+	static int32 GetMaxTokens(const FSettings& Settings) { return Settings.MaxTokens; }
+};
+
+struct GENERATIVEAISUPPORT_API FGenOpenAIStructuredTraits : FGenChatCompletionsTraits
+{
+	using FSettings = FGenOAIStructuredChatSettings;
+	static constexpr EGenAIOrgs Org = EGenAIOrgs::OpenAI;
+	static constexpr const TCHAR* ProviderName = TEXT("OpenAI");
+	static constexpr float TimeoutSeconds = 0.0f;
+
+	static FString GetEndpoint(const FSettings& Settings);
+	static FString GetModel(const FSettings& Settings);
+	static bool BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError);
+	static bool IsStreaming(const FSettings& Settings) { return Settings.ChatSettings.bStreamResponse; }
+	static const FGenRequestOptions& GetRequestOptions(const FSettings& Settings) { return Settings.ChatSettings.RequestOptions; }
+	static int32 GetMaxTokens(const FSettings& Settings) { return Settings.ChatSettings.MaxTokens; }
+
+	// Also report the model's refusal, see https://platform.openai.com/docs/guides/structured-outputs#refusals
+	static FGenParsedResponse ParseResponse(TConstArrayView<uint8> ResponseJson);
+	static void HandleStreamEvent(const FGenSSEEvent& Event, FGenStreamState& State, FGenChatStreamDelta& OutDelta);
+};
+
+struct GENERATIVEAISUPPORT_API FGenXAIChatTraits : FGenChatCompletionsTraits
+{
+	using FSettings = FGenXAIChatSettings;
+	static constexpr EGenAIOrgs Org = EGenAIOrgs::XAI;
+	static constexpr const TCHAR* ProviderName = TEXT("XAI");
+	static constexpr float TimeoutSeconds = 0.0f;
+
+	static FString GetEndpoint(const FSettings& Settings);
+	static FString GetModel(const FSettings& Settings);
+	static bool BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError);
+	static bool IsStreaming(const FSettings& Settings) { return Settings.bStreamResponse; }
+	static const FGenRequestOptions& GetRequestOptions(const FSettings& Settings) { return Settings.RequestOptions; }
+	static int32 GetMaxTokens(const FSettings& Settings) { return Settings.MaxTokens; }
+};
+
+struct GENERATIVEAISUPPORT_API FGenDeepSeekChatTraits : FGenChatCompletionsTraits
+{
+	using FSettings = FGenDSeekChatSettings;
+	static constexpr EGenAIOrgs Org = EGenAIOrgs::DeepSeek;
+	static constexpr const TCHAR* ProviderName = TEXT("DeepSeek");
+	// The reasoning model regularly takes longer than the default HTTP timeout
+	static constexpr float TimeoutSeconds = 180.0f;
+
+	static FString GetEndpoint(const FSettings& Settings);
+	static FString GetModel(const FSettings& Settings);
+	static bool BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError);
+	static bool IsStreaming(const FSettings& Settings) { return Settings.bStreamResponse; }
+	static const FGenRequestOptions& GetRequestOptions(const FSettings& Settings) { return Settings.RequestOptions; }
+	static int32 GetMaxTokens(const FSettings& Settings) { return Settings.MaxTokens; }
+
+	// Appends deepseek-reasoner's reasoning_content to non-streamed responses
+	static FGenParsedResponse ParseResponse(TConstArrayView<uint8> ResponseJson);
+};
+
+struct GENERATIVEAISUPPORT_API FGenClaudeChatTraits
+{
+	using FSettings = FGenClaudeChatSettings;
+	static constexpr EGenAIOrgs Org = EGenAIOrgs::Anthropic;
+	static constexpr const TCHAR* ProviderName = TEXT("Anthropic");
+	static constexpr float TimeoutSeconds = 180.0f;
+
+	static FString GetEndpoint(const FSettings& Settings);
+	static FString GetModel(const FSettings& Settings);
+	static void SetAuthHeaders(IHttpRequest& HttpRequest, const FString& ApiKey);
+	static bool BuildPayload(const FSettings& Settings, TArray<uint8>& OutPayload, FString& OutError);
+	static bool IsStreaming(const FSettings& Settings) { return Settings.bStreamResponse; }
+	static const FGenRequestOptions& GetRequestOptions(const FSettings& Settings) { return Settings.RequestOptions; }
+	static int32 GetMaxTokens(const FSettings& Settings) { return Settings.MaxTokens; }
+	static FGenParsedResponse ParseResponse(TConstArrayView<uint8> ResponseJson);
+
+	// Decodes https://docs.anthropic.com/en/api/messages-streaming events
+	static void HandleStreamEvent(const FGenSSEEvent& Event, FGenStreamState& State, FGenChatStreamDelta& OutDelta);
+};
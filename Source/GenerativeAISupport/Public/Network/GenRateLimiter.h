@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/GenAIOrgs.h"
+#include "Interfaces/IHttpResponse.h"
+
+/**
+ * Client side mirror of the providers' rate limits, one pair of token buckets (requests and tokens) per provider and API key.
+ * Buckets start out unlimited and learn their capacity and refill rate from the rate limit headers of each response
+ * (x-ratelimit-* for OpenAI style APIs, anthropic-ratelimit-* for Anthropic, retry-after for everyone).
+ * Also owns the retry budget that bounds how many retries may be in the air compared to fresh requests.
+ * Game thread only.
+ */
+class GENERATIVEAISUPPORT_API FGenRateLimiter
+{
+public:
+	static FGenRateLimiter& Get();
+
+	static uint32 MakeKeyHash(const FString& ApiKey) { return GetTypeHash(ApiKey); }
+
+	/**
+	 * Takes one request and EstimatedTokens tokens from the buckets of Org and key.
+	 * @return 0 if the request may go now, otherwise the seconds until it may, nothing is taken in that case
+	 */
+	double TryAcquire(EGenAIOrgs Org, uint32 KeyHash, int32 EstimatedTokens);
+
+	void UpdateFromResponse(EGenAIOrgs Org, uint32 KeyHash, const FHttpResponsePtr& Response);
+
+	// Seconds the response asks to wait before retrying, negative if it does not say
+	static double GetRetryAfterSeconds(const FHttpResponsePtr& Response);
+
+	// Every fresh request earns a fraction of a retry, every retry spends a whole one
+	void DepositRetryBudget();
+	bool TryWithdrawRetryBudget();
+
+private:
+	struct FBucket
+	{
+		// Unknown until the provider reports a limit
+		double Capacity = -1.0;
+		double Available = 0.0;
+		double RefillPerSecond = 0.0;
+		double LastRefillTime = 0.0;
+
+		void Refill(double Now);
+		void Apply(double Limit, double Remaining, double ResetSeconds, double Now);
+		double GetDelay(double Cost) const;
+	};
+
+	struct FKeyState
+	{
+		FBucket Requests;
+		FBucket Tokens;
+		// Set by retry-after and 429 responses, nothing goes out before this
+		double BlockedUntil = 0.0;
+	};
+
+	FGenRateLimiter() = default;
+
+	TMap<TPair<EGenAIOrgs, uint32>, FKeyState> States;
+	double RetryBudget = -1.0;
+};
@@ -0,0 +1,330 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Data/GenAIOrgs.h"
+#include "Data/GenRequestOptions.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Network/GenCassette.h"
+#include "Network/GenCompression.h"
+#include "Network/GenRateLimiter.h"
+#include "Network/GenRequestMetrics.h"
+#include "Network/GenRequestTypes.h"
+#include "Secure/GenSecureKey.h"
+#include "Utilities/GenTrace.h"
+#include "Utilities/GenSSEParser.h"
+
+/**
+ * Type-erased view of a provider traits type, so the shared request code in FGenRequestEngineBase
+ * does not have to be instantiated once per provider.
+ */
+struct GENERATIVEAISUPPORT_API FGenProviderPolicy
+{
+	EGenAIOrgs Org = EGenAIOrgs::Unknown;
+	const TCHAR* ProviderName = TEXT("");
+	FGenParsedResponse (*ParseResponse)(TConstArrayView<uint8> ResponseJson) = nullptr;
+	void (*HandleStreamEvent)(const FGenSSEEvent& Event, FGenStreamState& State, FGenChatStreamDelta& OutDelta) = nullptr;
+};
+
+struct FGenRequestContext;
+
+/**
+ * Response body of a provider request, written by the HTTP thread as bytes come off the wire and drained on the game thread.
+ * The response's own content must not be read before the request completed, the HTTP thread is still adding to it.
+ */
+class GENERATIVEAISUPPORT_API FGenResponseBodySink : public FArchive
+{
+public:
+	FGenResponseBodySink()
+	{
+		SetIsSaving(true);
+	}
+
+	virtual void Serialize(void* Data, int64 Length) override;
+
+	// Appends the bytes received since the last call to Body, false if there were none
+	bool Drain(TArray<uint8>& Body);
+
+	// Notes when each write arrived, set before the request is sent
+	void SetRecordChunks(bool bRecord) { bRecordChunks = bRecord; }
+
+	// Every write as a cassette chunk, timed from SendTime
+	void GetChunks(double SendTime, TArray<FGenCassetteChunk>& OutChunks);
+
+private:
+	FCriticalSection CriticalSection;
+	TArray<uint8> Received;
+	int64 TotalBytes = 0;
+	bool bRecordChunks = false;
+
+	// Arrival time and body size after each write
+	TArray<TPair<double, int64>> Writes;
+};
+
+/**
+ * One caller waiting on a provider request
+ */
+struct GENERATIVEAISUPPORT_API FGenRequestSubscriber
+{
+	uint32 Id = 0;
+	FGenResponseCallback ResponseCallback;
+	FGenDeltaCallback DeltaCallback;
+
+	// Request the caller currently waits on, coalescing may move it onto an identical one
+	TWeakPtr<FGenRequestContext> Owner;
+
+	// FGenRequestOptions::DeadlineSeconds and CancellationToken of this caller, 0 is no deadline
+	double DeadlineTime = 0.0;
+	FTSTicker::FDelegateHandle DeadlineTimer;
+	FGenCancellationToken CancellationToken;
+	FDelegateHandle CancellationBinding;
+};
+
+/**
+ * State of one in-flight provider request, shared by every caller coalesced onto it
+ */
+struct GENERATIVEAISUPPORT_API FGenRequestContext
+{
+	FGenProviderPolicy Policy;
+	TArray<TSharedRef<FGenRequestSubscriber>> Subscribers;
+
+	// Weak, the HTTP module owns the request while it runs, the request's delegates own this context
+	TWeakPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+
+	// Body received so far by the current attempt, drained from its FGenResponseBodySink
+	TArray<uint8> ReceivedBody;
+
+	bool bStream = false;
+	FGenSSEParser SSEParser;
+	FGenStreamState StreamState;
+
+	// Streamed bodies sent with Content-Encoding: gzip that the HTTP backend did not decode itself
+	bool bStreamEncodingKnown = false;
+	TUniquePtr<FGenStreamInflater> StreamInflater;
+	TArray<uint8> InflatedChunk;
+	// First bytes of the stream, held until there are enough to tell whether it is gzip
+	TArray<uint8> StreamHead;
+	bool bCompleted = false;
+
+	// Hash of endpoint and payload, identifies identical requests for the response cache
+	FString RequestKey;
+	EGenCachePolicy CachePolicy = EGenCachePolicy::Bypass;
+
+	// RequestKey qualified with the API key, requests only coalesce with requests made under the same account
+	FString CoalesceKey;
+	bool bCoalesce = false;
+
+	FGenRequestOptions Options;
+	float TimeoutSeconds = 0.0f;
+
+	// FGenRequestScheduler ticket while the request waits for a slot
+	uint64 SchedulerTicket = 0;
+
+	// FGenRateLimiter bucket and cost of the request
+	uint32 ApiKeyHash = 0;
+	int32 EstimatedTokens = 0;
+
+	// Retries made so far
+	int32 Attempt = 0;
+
+	// Resolved model name, FGenRequestMetrics keys its samples by provider and model
+	FString Model;
+	FGenRequestTimings Timings;
+
+	// Insights region from submit to result, see FGenTrace
+	FString TraceRegion;
+
+	// Set while a cassette records or replays, see FGenCassette
+	FString CassetteKey;
+	TArray<FGenCassetteChunk> CassetteChunks;
+};
+
+/**
+ * Caller side of a provider request. Cancelling detaches only this caller,
+ * the HTTP request itself is cancelled once nobody is waiting on it anymore.
+ */
+class GENERATIVEAISUPPORT_API FGenRequestHandle
+{
+public:
+	FGenRequestHandle() = default;
+	FGenRequestHandle(const TSharedRef<FGenRequestContext>& InContext, uint32 InSubscriberId)
+		: Context(InContext), SubscriberId(InSubscriberId)
+	{
+	}
+
+	// Detaches this caller, the last one to leave releases the connection whether the request is still queued or already streaming
+	void Cancel();
+
+	// True while the request has not delivered its result to this caller
+	bool IsPending() const;
+
+private:
+	friend class FGenRequestEngineBase;
+
+	TWeakPtr<FGenRequestContext> Context;
+	uint32 SubscriberId = 0;
+};
+
+/**
+ * Provider independent half of the request engine: HTTP setup, stream decoding, error handling and result delivery.
+ */
+class GENERATIVEAISUPPORT_API FGenRequestEngineBase
+{
+protected:
+	static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateHttpRequest(const FString& Url, float TimeoutSeconds);
+
+	// Sets the request body, gzip compressed if the provider accepts that
+	static void SetRequestBody(FGenRequestContext& Context, IHttpRequest& HttpRequest, TArray<uint8>&& Payload);
+
+	// Arms the caller's deadline and cancellation token, a caller whose token is already cancelled fails straight away
+	static FGenRequestHandle Subscribe(const TSharedRef<FGenRequestContext>& Context, const FGenRequestOptions& Options,
+	                                   FGenResponseCallback ResponseCallback, FGenDeltaCallback DeltaCallback);
+
+	// Binds the response handlers and hands the request to the scheduler, which sends it once its provider has a free slot
+	static void Start(const TSharedRef<FGenRequestContext>& Context, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest);
+
+	// Delivers the final result exactly once to every subscriber
+	static void Complete(const TSharedRef<FGenRequestContext>& Context, const FGenParsedResponse& Result);
+
+	// Stores the request options and applies the ones that key off the request's endpoint and payload
+	static void ResolveRequestKey(const TSharedRef<FGenRequestContext>& Context, const FGenRequestOptions& Options,
+	                              const FString& Url, TConstArrayView<uint8> Payload, uint32 ApiKeyHash);
+
+	// Completes the request straight away on a cache hit
+	static bool TryCompleteFromCache(const TSharedRef<FGenRequestContext>& Context);
+
+	// Moves the subscribers of Context onto an identical request that is already in flight, if there is one
+	static bool TryJoinInFlight(const TSharedRef<FGenRequestContext>& Context, FGenRequestHandle& InOutHandle);
+
+	// Answers the request from the cassette being replayed, fails it if the cassette has no recording of it
+	static bool TryReplayFromCassette(const TSharedRef<FGenRequestContext>& Context, const FString& Url, TConstArrayView<uint8> Payload);
+
+private:
+	// Decodes bytes of the streamed body as they arrive, each byte is passed exactly once
+	static void ConsumeStream(const TSharedRef<FGenRequestContext>& Context, TConstArrayView<uint8> NewBytes, bool bFinal);
+	static void HandleCompletion(const TSharedRef<FGenRequestContext>& Context, const FHttpResponsePtr& Response, bool bSucceeded);
+
+	// Turns a complete response, received or replayed, into the result. bReceived is false when no response arrived
+	static void FinishResponse(const TSharedRef<FGenRequestContext>& Context, bool bReceived, int32 ResponseCode, const TArray<uint8>& Content);
+
+	// Feeds a recorded response through ConsumeStream and FinishResponse at the cassette's replay speed
+	static void Replay(const TSharedRef<FGenRequestContext>& Context, const TSharedRef<const FGenCassetteEntry>& Entry, float Speed);
+
+	// Sends the request again after a jittered backoff if the response is worth retrying and the retry budget allows it
+	static bool TryScheduleRetry(const TSharedRef<FGenRequestContext>& Context, const FHttpResponsePtr& Response);
+
+	// Fails one caller that ran past its deadline or was cancelled through its token, the request is torn down once nobody waits on it
+	static void Abort(const TWeakPtr<FGenRequestSubscriber>& WeakSubscriber, const FString& Error);
+
+	friend class FGenRequestHandle;
+	static void Unsubscribe(const TSharedRef<FGenRequestContext>& Context, uint32 SubscriberId);
+};
+
+/**
+ * Request engine for one provider, parameterised at compile time by a traits type describing
+ * the endpoint, auth headers, payload mapping and response extraction (see GenProviderTraits.h).
+ *
+ * A traits type provides:
+ *   using FSettings                      - the settings struct the provider is driven by
+ *   static constexpr EGenAIOrgs Org      - used to look up the API key
+ *   static constexpr const TCHAR* ProviderName
+ *   static constexpr float TimeoutSeconds  - 0 keeps the engine wide HTTP timeout
+ *   static FString GetEndpoint(const FSettings&)
+ *   static FString GetModel(const FSettings&)     - the model name sent, for metrics
+ *   static void SetAuthHeaders(IHttpRequest&, const FString& ApiKey)
+ *   static bool BuildPayload(const FSettings&, TArray<uint8>& OutPayload, FString& OutError)  - condensed UTF-8 JSON
+ *   static bool IsStreaming(const FSettings&)
+ *   static const FGenRequestOptions& GetRequestOptions(const FSettings&)
+ *   static int32 GetMaxTokens(const FSettings&)   - completion tokens requested, for the rate limit estimate
+ *   static FGenParsedResponse ParseResponse(TConstArrayView<uint8> ResponseJson)  - raw UTF-8 response body
+ *   static void HandleStreamEvent(const FGenSSEEvent&, FGenStreamState&, FGenChatStreamDelta& OutDelta)
+ */
+template <typename TTraits>
+class TGenRequestEngine : private FGenRequestEngineBase
+{
+public:
+	using FSettings = typename TTraits::FSettings;
+
+	/**
+	 * Sends a request, ResponseCallback is invoked exactly once (also when the request could not be started)
+	 * unless the returned handle is cancelled first. A deadline or cancellation token in the request options fails it instead.
+	 * DeltaCallback is invoked for each streamed update when the settings ask for a streamed response.
+	 * Must be called on the game thread, where the HTTP module delivers responses.
+	 */
+	static FGenRequestHandle Send(const FSettings& Settings, FGenResponseCallback ResponseCallback, FGenDeltaCallback DeltaCallback = nullptr)
+	{
+		GENAI_TRACE_SCOPE("GenAI::Send");
+		const TSharedRef<FGenRequestContext> Context = MakeShared<FGenRequestContext>();
+		Context->Policy = MakePolicy();
+		Context->bStream = TTraits::IsStreaming(Settings);
+		Context->Model = TTraits::GetModel(Settings);
+		const FGenRequestOptions& Options = TTraits::GetRequestOptions(Settings);
+		FGenRequestHandle Handle = Subscribe(Context, Options, MoveTemp(ResponseCallback), MoveTemp(DeltaCallback));
+		if (Context->bCompleted)
+		{
+			return Handle;
+		}
+
+		// Sized after the previous request, conversations only grow, so this is usually the only allocation of the body
+		static int32 PayloadSizeHint = 1024;
+		TArray<uint8> Payload;
+		Payload.Reserve(PayloadSizeHint);
+		FString PayloadError;
+		bool bPayloadBuilt;
+		{
+			GENAI_TRACE_SCOPE("GenAI::BuildPayload");
+			bPayloadBuilt = TTraits::BuildPayload(Settings, Payload, PayloadError);
+		}
+		if (!bPayloadBuilt)
+		{
+			Complete(Context, FGenParsedResponse::Failure(PayloadError));
+			return Handle;
+		}
+		PayloadSizeHint = Payload.Num() + Payload.Num() / 4;
+
+		// Looked up first for the coalescing key, a missing key only fails requests that cannot be answered without one
+		const FString ApiKey = UGenSecureKey::GetGenerativeAIApiKey(TTraits::Org);
+		Context->ApiKeyHash = FGenRateLimiter::MakeKeyHash(ApiKey);
+
+		const FString Url = TTraits::GetEndpoint(Settings);
+		ResolveRequestKey(Context, Options, Url, Payload, Context->ApiKeyHash);
+		if (TryCompleteFromCache(Context) || TryJoinInFlight(Context, Handle) || TryReplayFromCassette(Context, Url, Payload))
+		{
+			return Handle;
+		}
+
+		if (ApiKey.IsEmpty())
+		{
+			Complete(Context, FGenParsedResponse::Failure(FString::Printf(TEXT("%s API key not set"), TTraits::ProviderName)));
+			return Handle;
+		}
+
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, TTraits::TimeoutSeconds);
+		TTraits::SetAuthHeaders(*HttpRequest, ApiKey);
+
+		Context->TimeoutSeconds = TTraits::TimeoutSeconds;
+		// Providers count the requested completion tokens against the limit up front, the prompt at roughly four bytes per token
+		Context->EstimatedTokens = Payload.Num() / 4 + FMath::Max(TTraits::GetMaxTokens(Settings), 0);
+		SetRequestBody(*Context, *HttpRequest, MoveTemp(Payload));
+		FGenRateLimiter::Get().DepositRetryBudget();
+
+		Start(Context, HttpRequest);
+		return Handle;
+	}
+
+private:
+	static FGenProviderPolicy MakePolicy()
+	{
+		FGenProviderPolicy Policy;
+		Policy.Org = TTraits::Org;
+		Policy.ProviderName = TTraits::ProviderName;
+		Policy.ParseResponse = &TTraits::ParseResponse;
+		Policy.HandleStreamEvent = &TTraits::HandleStreamEvent;
+		return Policy;
+	}
+};
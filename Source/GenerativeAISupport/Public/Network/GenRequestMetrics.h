@@ -0,0 +1,169 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GenRequestMetrics.generated.h"
+
+/**
+ * Timestamps and sizes of one request as it passes through the request engine, FPlatformTime::Seconds, 0 until reached
+ */
+struct GENERATIVEAISUPPORT_API FGenRequestTimings
+{
+	// Handed to the scheduler, the first attempt's time is kept across retries
+	double SubmitTime = 0.0;
+	// Latest attempt's, handed to the scheduler and taken off its queue
+	double EnqueueTime = 0.0;
+	double SendTime = 0.0;
+	double FirstByteTime = 0.0;
+	// First streamed delta carrying content or reasoning
+	double FirstTokenTime = 0.0;
+
+	// Summed over all attempts
+	double QueueSeconds = 0.0;
+	// Spent decoding the response body or the stream's events
+	double ParseSeconds = 0.0;
+
+	int64 RequestBytes = 0;
+	int64 RequestWireBytes = 0;
+	int64 ResponseWireBytes = 0;
+};
+
+/**
+ * Percentiles of one metric over the recent requests of a provider and model, successful requests only
+ */
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenMetricPercentiles
+{
+	GENERATED_BODY()
+
+	// Requests that reported the metric
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	int32 Count = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	float P50 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	float P95 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	float P99 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	float Max = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenRequestMetricsSummary
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FString Provider;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FString Model;
+
+	// Since the last reset, the percentiles only cover the most recent of them
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	int64 Requests = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	int64 Failures = 0;
+
+	// Waiting for a free slot in the scheduler
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FGenMetricPercentiles QueueMs;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FGenMetricPercentiles TimeToFirstByteMs;
+
+	// Streamed requests only
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FGenMetricPercentiles TimeToFirstTokenMs;
+
+	// From submitting to the result, queue and retries included
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FGenMetricPercentiles TotalMs;
+
+	// Output tokens over the time after the first token (streamed) or after sending (not streamed), needs reported usage
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FGenMetricPercentiles TokensPerSecond;
+
+	// Uncompressed request body
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FGenMetricPercentiles RequestBytes;
+
+	// Response body as received, compressed if it was
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FGenMetricPercentiles ResponseBytes;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Metrics")
+	FGenMetricPercentiles ParseMs;
+};
+
+/**
+ * One completed request, -1 marks metrics the request did not report
+ */
+struct GENERATIVEAISUPPORT_API FGenRequestSample
+{
+	FDateTime Timestamp;
+	bool bSuccess = false;
+	bool bStream = false;
+	int32 Attempts = 1;
+	int64 OutputTokens = -1;
+
+	float QueueMs = -1.0f;
+	float TimeToFirstByteMs = -1.0f;
+	float TimeToFirstTokenMs = -1.0f;
+	float TotalMs = -1.0f;
+	float TokensPerSecond = -1.0f;
+	float RequestBytes = -1.0f;
+	float ResponseBytes = -1.0f;
+	float ParseMs = -1.0f;
+};
+
+/**
+ * Latency and throughput of every request that went out to a provider, kept per provider and model.
+ * Each keeps a rolling window of its last samples for percentiles and CSV dumps, requests served from the response
+ * cache or an identical in-flight request are not sampled. Fed by the request engine, game thread only.
+ * From the console: "GenAI.Stats" logs the summary to LogGenPerformance, "GenAI.Stats csv [Path]" dumps the samples,
+ * "GenAI.Stats reset" clears them.
+ */
+class GENERATIVEAISUPPORT_API FGenRequestMetrics
+{
+public:
+	static constexpr int32 MaxSamplesPerModel = 512;
+
+	static void Record(const FString& Provider, const FString& Model, const FGenRequestSample& Sample);
+
+	static TArray<FGenRequestMetricsSummary> GetSummaries();
+
+	static void Reset();
+
+	static void LogSummaries();
+
+	// Every retained sample, one row each, an empty path writes Saved/GenAI/Metrics/RequestMetrics-<time>.csv
+	static bool WriteCsv(const FString& FilePath, FString* OutWrittenPath = nullptr);
+};
+
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenRequestMetricsLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Metrics")
+	static TArray<FGenRequestMetricsSummary> GetRequestMetrics();
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Metrics")
+	static void ResetRequestMetrics();
+
+	// An empty path writes Saved/GenAI/Metrics/RequestMetrics-<time>.csv
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Metrics")
+	static bool WriteRequestMetricsCsv(const FString& FilePath);
+};
@@ -0,0 +1,140 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/GenAIOrgs.h"
+#include "Data/GenRequestOptions.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GenRequestScheduler.generated.h"
+
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenSchedulerLaneStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Scheduler")
+	EGenRequestPriority Priority = EGenRequestPriority::Gameplay;
+
+	// Requests currently waiting for a slot
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Scheduler")
+	int32 QueueDepth = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Scheduler")
+	int64 DispatchedRequests = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Scheduler")
+	float AverageWaitSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Scheduler")
+	float MaxWaitSeconds = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenSchedulerStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Scheduler")
+	int32 InFlightRequests = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Scheduler")
+	int32 QueuedRequests = 0;
+
+	// One entry per EGenRequestPriority, summed over all providers
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Scheduler")
+	TArray<FGenSchedulerLaneStats> Lanes;
+};
+
+/**
+ * Admission control in front of the HTTP module. Every provider gets at most
+ * UGenerativeAISupportRuntimeSettings::GetMaxConcurrentRequests requests in flight, the rest waits.
+ * A freed slot goes to the highest non-empty priority lane, inside a lane callers are served by
+ * weighted fair queuing so one chatty caller cannot starve the others. While the rate limit holds back the next
+ * request of a lane, later requests of that lane that fit the remaining budget go first.
+ * Game thread only, like the HTTP module's completion delegates.
+ */
+class GENERATIVEAISUPPORT_API FGenRequestScheduler
+{
+public:
+	static FGenRequestScheduler& Get();
+
+	/**
+	 * Queues Dispatch until Org has a free slot and FGenRateLimiter lets the request through, it may run before Submit returns.
+	 * Every dispatched request must hand its slot back through Release.
+	 * @return ticket for Withdraw
+	 */
+	uint64 Submit(EGenAIOrgs Org, const FGenRequestOptions& Options, uint32 ApiKeyHash, int32 EstimatedTokens, TFunction<void()> Dispatch);
+
+	// Removes a request that is still waiting, returns false if it was dispatched already
+	bool Withdraw(EGenAIOrgs Org, uint64 Ticket);
+
+	void Release(EGenAIOrgs Org);
+
+	FGenSchedulerStats GetStats() const;
+
+private:
+	static constexpr int32 NumPriorities = static_cast<int32>(EGenRequestPriority::Background) + 1;
+
+	struct FQueuedRequest
+	{
+		uint64 Ticket = 0;
+		double FinishTag = 0.0;
+		double EnqueueTime = 0.0;
+		uint32 ApiKeyHash = 0;
+		int32 EstimatedTokens = 0;
+		TFunction<void()> Dispatch;
+	};
+
+	struct FLane
+	{
+		// Min-heap on FinishTag, ties broken by submission order
+		TArray<FQueuedRequest> Queue;
+		// Finish tag of the last dispatched request, a caller that was idle restarts from here
+		double VirtualTime = 0.0;
+		TMap<FName, double> LastFinishTags;
+	};
+
+	struct FProviderQueue
+	{
+		int32 InFlight = 0;
+		bool bPumping = false;
+		// Set while a wake up is pending for a rate limited queue
+		bool bWakeScheduled = false;
+		FLane Lanes[NumPriorities];
+	};
+
+	struct FLaneCounters
+	{
+		int64 Dispatched = 0;
+		double TotalWaitSeconds = 0.0;
+		double MaxWaitSeconds = 0.0;
+	};
+
+	FGenRequestScheduler() = default;
+
+	void Pump(EGenAIOrgs Org);
+
+	// Takes the rate limit budget for the head of Lane, or for the first request behind it that fits while the head is
+	// throttled. Returns its index in Lane.Queue, INDEX_NONE with the seconds to wait if nothing fits
+	int32 AcquireNext(EGenAIOrgs Org, const FLane& Lane, double& OutThrottleSeconds) const;
+
+	TMap<EGenAIOrgs, FProviderQueue> Providers;
+	FLaneCounters Counters[NumPriorities];
+	uint64 NextTicket = 0;
+};
+
+/**
+ * Blueprint access to the request scheduler's metrics
+ */
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenRequestSchedulerLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Scheduler")
+	static FGenSchedulerStats GetRequestSchedulerStats();
+};
@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One incremental update of a streamed response.
+ * Content and ReasoningContent are deltas, FinishReason is only set on the last update.
+ */
+struct GENERATIVEAISUPPORT_API FGenChatStreamDelta
+{
+	FString Content;
+	FString ReasoningContent;
+	FString FinishReason;
+
+	bool IsEmpty() const { return Content.IsEmpty() && ReasoningContent.IsEmpty() && FinishReason.IsEmpty(); }
+};
+
+/**
+ * Token counts the provider reported for one request, zero where it reported none.
+ * InputTokens only counts prompt tokens that were neither written to nor read from the provider's prompt cache.
+ */
+struct GENERATIVEAISUPPORT_API FGenTokenUsage
+{
+	int64 InputTokens = 0;
+	int64 OutputTokens = 0;
+	int64 CacheCreationInputTokens = 0;
+	int64 CacheReadInputTokens = 0;
+
+	bool IsSet() const { return InputTokens > 0 || OutputTokens > 0 || CacheCreationInputTokens > 0 || CacheReadInputTokens > 0; }
+};
+
+// Final result callback shared by every provider request path: Response, Error, Success
+using FGenResponseCallback = TFunction<void(const FString&, const FString&, bool)>;
+
+// Streaming callback shared by every provider request path
+using FGenDeltaCallback = TFunction<void(const FGenChatStreamDelta&)>;
+
+/**
+ * Result of decoding a complete (non-streamed) response body
+ */
+struct GENERATIVEAISUPPORT_API FGenParsedResponse
+{
+	FString Content;
+	FString Error;
+	bool bSuccess = false;
+	FGenTokenUsage Usage;
+
+	static FGenParsedResponse Success(FString InContent)
+	{
+		FGenParsedResponse Result;
+		Result.Content = MoveTemp(InContent);
+		Result.bSuccess = true;
+		return Result;
+	}
+
+	static FGenParsedResponse Failure(FString InError)
+	{
+		FGenParsedResponse Result;
+		Result.Error = MoveTemp(InError);
+		return Result;
+	}
+};
+
+/**
+ * Everything assembled so far from a streamed response, channels are kept separate
+ */
+struct GENERATIVEAISUPPORT_API FGenStreamState
+{
+	FString Content;
+	FString ReasoningContent;
+	FString FinishReason;
+	FString ErrorMessage;
+	FGenTokenUsage Usage;
+	bool bDone = false;
+};
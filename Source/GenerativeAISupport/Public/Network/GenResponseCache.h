@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GenResponseCache.generated.h"
+
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenCacheStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Cache")
+	int64 MemoryHits = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Cache")
+	int64 DiskHits = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Cache")
+	int64 Misses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Cache")
+	int64 Stores = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Cache")
+	int32 MemoryEntries = 0;
+};
+
+/**
+ * Two-tier response cache: a bounded in-memory LRU in front of an on-disk store under Saved/GenAI/ResponseCache.
+ * Entries are addressed by a SHA-1 of endpoint and serialized payload, API keys never take part in the key.
+ * The keys on disk are indexed once on a background thread at startup, so a memory miss only touches the disk when the
+ * entry is known to be there. Entries written by an earlier session are misses until that index has loaded.
+ * Which requests read or write it is decided per request by FGenRequestOptions::CachePolicy.
+ */
+class GENERATIVEAISUPPORT_API FGenResponseCache
+{
+public:
+	static FGenResponseCache& Get();
+
+	static FString ComputeKey(const FString& Url, TConstArrayView<uint8> Payload);
+
+	// Looks the key up in memory, then on disk if the disk index has it (promoting disk hits into memory)
+	bool Find(const FString& Key, FString& OutContent);
+
+	void Store(const FString& Key, const FString& Content);
+
+	void Clear(bool bIncludeDisk);
+
+	FGenCacheStats GetStats() const;
+
+private:
+	FGenResponseCache();
+
+	FString GetEntryPath(const FString& Key) const;
+	void LoadDiskIndex();
+
+	mutable FCriticalSection CriticalSection;
+	TLruCache<FString, FString> MemoryCache;
+	TSet<FString> DiskKeys;
+	FString DiskDirectory;
+	bool bPersistToDisk = true;
+	FGenCacheStats Stats;
+};
+
+/**
+ * Blueprint access to the response cache
+ */
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenResponseCacheLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Cache")
+	static FGenCacheStats GetResponseCacheStats();
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Cache")
+	static void ClearResponseCache(bool bIncludeDisk = false);
+};
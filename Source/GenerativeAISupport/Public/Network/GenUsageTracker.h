@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/GenAIOrgs.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Network/GenRequestTypes.h"
+#include "GenUsageTracker.generated.h"
+
+USTRUCT(BlueprintType)
+struct GENERATIVEAISUPPORT_API FGenTokenUsageStats
+{
+	GENERATED_BODY()
+
+	// Requests whose response reported usage, cache hits of the local response cache are not counted
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Usage")
+	int64 Requests = 0;
+
+	// Prompt tokens billed at the full rate
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Usage")
+	int64 InputTokens = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Usage")
+	int64 OutputTokens = 0;
+
+	// Prompt tokens written to the provider's prompt cache
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Usage")
+	int64 CacheCreationInputTokens = 0;
+
+	// Prompt tokens served from the provider's prompt cache
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Usage")
+	int64 CacheReadInputTokens = 0;
+
+	// Requests that read at least one prompt token from the cache
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Usage")
+	int64 CacheHitRequests = 0;
+
+	// Share of all prompt tokens that were served from the cache
+	UPROPERTY(BlueprintReadOnly, Category = "GenAI|Usage")
+	float CacheHitRate = 0.0f;
+};
+
+/**
+ * Sums the token usage providers report per response, mainly to see how much of the prompt their prompt caches serve.
+ * Fed by the request engine, game thread only.
+ */
+class GENERATIVEAISUPPORT_API FGenUsageTracker
+{
+public:
+	static void Record(EGenAIOrgs Org, const FGenTokenUsage& Usage);
+
+	static FGenTokenUsageStats GetStats(EGenAIOrgs Org);
+	static void ResetStats();
+};
+
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenUsageLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Usage")
+	static FGenTokenUsageStats GetTokenUsageStats(EGenAIOrgs Org);
+
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Usage")
+	static void ResetTokenUsageStats();
+};
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Forward-only JSON writer that appends condensed UTF-8 straight into a byte buffer, the buffer can be sent as is.
+ * Used for request bodies instead of building an FJsonObject tree and pretty printing it to a UTF-16 FString.
+ * Does not validate structure, Begin/End calls have to be balanced by the caller.
+ */
+class GENERATIVEAISUPPORT_API FGenJsonPayloadWriter
+{
+public:
+	explicit FGenJsonPayloadWriter(TArray<uint8>& InBuffer);
+
+	void BeginObject();
+	void BeginObject(FStringView Name);
+	void EndObject();
+
+	void BeginArray(FStringView Name);
+	void EndArray();
+
+	void WriteString(FStringView Name, FStringView Value);
+	void WriteNumber(FStringView Name, int32 Value);
+	void WriteNumber(FStringView Name, float Value);
+	void WriteBool(FStringView Name, bool Value);
+
+	// Writes already serialized JSON as the value of Name, the caller vouches for its validity
+	void WriteRawJson(FStringView Name, FStringView Json);
+	void WriteRawJson(FStringView Name, TConstArrayView<uint8> Utf8Json);
+
+private:
+	void WriteSeparator();
+	void WriteName(FStringView Name);
+	void WriteQuoted(FStringView Value);
+	void WriteUtf8(FStringView Value);
+	void WriteAscii(const ANSICHAR* Text, int32 Length);
+
+	TArray<uint8>& Buffer;
+
+	// One entry per open object / array, true once it holds a value and the next one needs a comma
+	TArray<bool, TInlineAllocator<8>> NeedsComma;
+};
@@ -0,0 +1,113 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EGenJsonToken : uint8
+{
+	None,
+	ObjectStart,
+	ObjectEnd,
+	ArrayStart,
+	ArrayEnd,
+	Key,
+	String,
+	Number,
+	True,
+	False,
+	Null,
+	End,
+	Error
+};
+
+/**
+ * Pull parser reading JSON straight from a UTF-8 buffer without building a DOM or converting the whole text to TCHAR.
+ * Strings are handed out as views into the buffer and only decoded (unescaped, converted) on request.
+ * The buffer has to outlive the reader.
+ */
+class GENERATIVEAISUPPORT_API FGenJsonPullReader
+{
+public:
+	explicit FGenJsonPullReader(TConstArrayView<uint8> InJson);
+
+	// Advances to the next token, separators (',' and ':') are consumed silently
+	EGenJsonToken Next();
+
+	EGenJsonToken GetToken() const { return Token; }
+
+	// Raw, still escaped bytes of the current Key / String token, or the text of the current Number / literal
+	FAnsiStringView GetRawValue() const { return RawValue; }
+
+	// Current Key / String token, unescaped
+	FString GetString() const;
+
+	// Skips the value starting at Token, including everything nested in it
+	bool SkipValue();
+
+	// Same, for a value that has not been read yet (the one following the current Key)
+	bool SkipNextValue();
+
+private:
+	// Whitespace, ',' and ':' - the reader does not validate separators
+	void SkipSeparators();
+	void FinishValue();
+	EGenJsonToken ReadString(EGenJsonToken StringToken);
+	EGenJsonToken ReadLiteral(const ANSICHAR* Literal, int32 LiteralLength, EGenJsonToken LiteralToken);
+	EGenJsonToken ReadNumber();
+	EGenJsonToken Fail();
+
+	const ANSICHAR* Data = nullptr;
+	int32 Length = 0;
+	int32 Position = 0;
+
+	EGenJsonToken Token = EGenJsonToken::None;
+	FAnsiStringView RawValue;
+	bool bRawValueHasEscapes = false;
+
+	// One entry per open container, true for objects
+	TArray<bool, TInlineAllocator<16>> Containers;
+	bool bExpectKey = false;
+};
+
+/**
+ * One value to pick out of a JSON document with GenJson::ExtractFields.
+ * Path segments are separated by '.', numbers index arrays and "*" matches any index, e.g. "choices.0.message.content"
+ * or "content.*.text". The first match wins. Keys are compared byte for byte, escaped keys in the document never match.
+ */
+struct GENERATIVEAISUPPORT_API FGenJsonFieldQuery
+{
+	// Path has to outlive the query, pass a literal
+	explicit FGenJsonFieldQuery(const ANSICHAR* Path);
+
+	bool IsString() const { return bFound && ValueType == EGenJsonToken::String; }
+
+	struct FSegment
+	{
+		FAnsiStringView Name;
+		int32 Index = INDEX_NONE;
+		bool bAnyIndex = false;
+	};
+	TArray<FSegment, TInlineAllocator<6>> Segments;
+
+	// Decoded string, or the literal text of a number / bool / null, empty for objects and arrays
+	FString Value;
+	// ObjectStart / ArrayStart for containers
+	EGenJsonToken ValueType = EGenJsonToken::None;
+	bool bFound = false;
+};
+
+namespace GenJson
+{
+	/**
+	 * Single pass over Json filling every query, subtrees no query points into are skipped without decoding.
+	 * Stops reading as soon as every query has been answered.
+	 * @return false if Json is malformed (queries answered before the error keep their values)
+	 */
+	GENERATIVEAISUPPORT_API bool ExtractFields(TConstArrayView<uint8> Json, TArrayView<FGenJsonFieldQuery* const> Queries);
+
+	// Lossy conversion of a UTF-8 buffer for error messages and logs
+	GENERATIVEAISUPPORT_API FString ToDebugString(TConstArrayView<uint8> Json);
+}
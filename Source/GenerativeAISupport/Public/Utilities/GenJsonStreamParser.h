@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/JsonTypes.h"
+
+/**
+ * A value of a structured response that has been received in full while the rest of the response is still streaming
+ */
+struct GENERATIVEAISUPPORT_API FGenJsonStreamEvent
+{
+	// Top level field the value belongs to, empty when the response itself is an array
+	FString Field;
+
+	// Element of the array Field, INDEX_NONE when the event covers the whole field
+	int32 Index = INDEX_NONE;
+
+	EJson Type = EJson::None;
+
+	// Complete JSON text of the value
+	FString Json;
+
+	// "title", "quests[3]"
+	FString GetPath() const;
+};
+
+/**
+ * Incremental JSON parser for structured responses arriving as text deltas. Reports every top level field of the
+ * response once its value is complete, and before that every element of a top level array as soon as that element
+ * is complete, so "quests[3]" can be used while "quests[4]" is still being generated.
+ * Only tracks nesting, strings and escapes, malformed JSON is caught by whoever parses the reported values.
+ */
+class GENERATIVEAISUPPORT_API FGenJsonStreamParser
+{
+public:
+	using FOnValue = TFunctionRef<void(const FGenJsonStreamEvent&)>;
+
+	// Appends Text and reports the values it completes, false once the text can no longer be a JSON object or array
+	bool Feed(FStringView Text, FOnValue OnValue);
+
+	// The root object or array has been closed
+	bool IsDone() const { return bDone; }
+	bool HasFailed() const { return bFailed; }
+
+	// Everything fed so far
+	const FString& GetText() const { return Text; }
+
+	void Reset();
+
+private:
+	// Only values of the root and of a top level array are reported, deeper values are tracked through the stack alone
+	static constexpr int32 ReportedDepth = 2;
+
+	void BeginValue(int32 Start, EJson Type);
+	void EndValue(int32 EndPosition, FOnValue OnValue);
+	void EndScalar(int32 EndPosition, FOnValue OnValue);
+	bool Fail();
+
+	FString Text;
+	int32 Position = 0;
+
+	// '{' or '[' for every open container, with the number of values it has completed so far
+	TArray<TCHAR, TInlineAllocator<16>> Stack;
+	TArray<int32, TInlineAllocator<16>> ChildCounts;
+
+	// Start and type of the value open at each reported depth
+	int32 ValueStarts[ReportedDepth + 1] = {};
+	EJson ValueTypes[ReportedDepth + 1] = {};
+
+	// Key of the top level field being read
+	FString Field;
+
+	int32 StringStart = INDEX_NONE;
+	int32 ScalarStart = INDEX_NONE;
+	bool bInString = false;
+	bool bEscaped = false;
+	bool bStringIsKey = false;
+	bool bExpectKey = false;
+	bool bDone = false;
+	bool bFailed = false;
+};
@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A single Server-Sent-Events message, as dispatched by FGenSSEParser.
+ * Event is empty when the server did not send an "event:" line.
+ * Data is kept as the raw UTF-8 bytes, it is JSON for every provider and goes to FGenJsonPullReader as is.
+ */
+struct GENERATIVEAISUPPORT_API FGenSSEEvent
+{
+	FString Event;
+	TArray<uint8> Data;
+
+	bool IsData(FAnsiStringView Value) const
+	{
+		return Data.Num() == Value.Len() && FMemory::Memcmp(Data.GetData(), Value.GetData(), Value.Len()) == 0;
+	}
+};
+
+/**
+ * Incremental Server-Sent-Events parser (https://html.spec.whatwg.org/multipage/server-sent-events.html).
+ * Bytes can be fed in arbitrary chunks as they arrive on the HTTP response, the parser keeps any
+ * partial line around until the rest of it shows up and dispatches an event on every blank line.
+ */
+class GENERATIVEAISUPPORT_API FGenSSEParser
+{
+public:
+	using FOnEvent = TFunctionRef<void(const FGenSSEEvent&)>;
+
+	// Feeds raw UTF-8 bytes into the parser, dispatching every event completed by them
+	void Feed(const uint8* Data, int64 Num, FOnEvent OnEvent);
+
+	// Dispatches a trailing event that was not terminated by a blank line, call once the stream ended
+	void Flush(FOnEvent OnEvent);
+
+	void Reset();
+
+	// True once at least one event has been dispatched
+	bool HasReceivedEvents() const { return bReceivedEvents; }
+
+private:
+	void ProcessLine(const uint8* Line, int32 Length, FOnEvent OnEvent);
+	void DispatchEvent(FOnEvent OnEvent);
+
+	// Bytes of a line that has not been terminated yet
+	TArray<uint8> PendingLine;
+
+	FGenSSEEvent CurrentEvent;
+	bool bHasData = false;
+	bool bReceivedEvents = false;
+	bool bSkipLeadingLineFeed = false;
+};
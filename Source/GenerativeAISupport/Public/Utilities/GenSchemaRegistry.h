@@ -0,0 +1,100 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GenSchemaRegistry.generated.h"
+
+/**
+ * JSON schema that was parsed and validated once, kept as condensed UTF-8 ready to be spliced into a request payload
+ */
+struct GENERATIVEAISUPPORT_API FGenCompiledSchema
+{
+	FName Name;
+	TArray<uint8> Utf8Json;
+
+	// Set for schemas derived from a struct, every property is required and no other property is allowed,
+	// which is what the provider's strict mode asks for
+	bool bStrict = false;
+
+	// Struct the schema was derived from, if any
+	TWeakObjectPtr<const UScriptStruct> Struct;
+};
+
+/**
+ * Compiled JSON schemas for structured outputs, so a structured request does not parse and validate its schema every
+ * time it is sent. Schemas are looked up by registered name, by the struct they were derived from or by their text.
+ * Schemas can be derived from a USTRUCT through reflection: bool, numbers, strings, names, texts, enums, arrays, sets
+ * and nested structs are supported, other properties (maps, object references...) are left out. Structs that contain
+ * themselves (through an array) are written once under $defs and referenced with $ref.
+ * GENAI_REGISTER_SCHEMA(FMyStruct) in a .cpp compiles a struct's schema, and prepares FGenStructDecoder for it, when the
+ * engine has finished starting up.
+ * Thread safe.
+ */
+class GENERATIVEAISUPPORT_API FGenSchemaRegistry
+{
+public:
+	static FGenSchemaRegistry& Get();
+
+	// Compiles SchemaJson and makes it available under Name, replacing an earlier schema of that name
+	TSharedPtr<const FGenCompiledSchema> Register(FName Name, const FString& SchemaJson, FString* OutError = nullptr);
+
+	// Derives, compiles and caches the schema of Struct, named after the struct, later calls return the cached one
+	TSharedPtr<const FGenCompiledSchema> RegisterStruct(const UScriptStruct* Struct);
+
+	TSharedPtr<const FGenCompiledSchema> Find(FName Name) const;
+
+	// Compiled schema of an ad hoc schema text, compiled on first use and then served by text
+	TSharedPtr<const FGenCompiledSchema> FindOrAddJson(const FString& SchemaJson, FString& OutError);
+
+	// Struct, then registered name, then schema text, the first one that is set decides
+	TSharedPtr<const FGenCompiledSchema> Resolve(const UScriptStruct* Struct, FName Name, const FString& SchemaJson, FString& OutError);
+
+	// Schema of Struct as condensed JSON text
+	static FString MakeSchemaFromStruct(const UScriptStruct* Struct);
+
+	// Queues a struct for GENAI_REGISTER_SCHEMA, compiled once the engine is up or at the first lookup, whichever comes first
+	void AddPendingStruct(UScriptStruct* (*GetStruct)());
+	void CompilePendingStructs();
+
+private:
+	FGenSchemaRegistry() = default;
+
+	static TSharedPtr<FGenCompiledSchema> Compile(FName Name, const FString& SchemaJson, FString& OutError);
+
+	mutable FRWLock Lock;
+	TMap<FName, TSharedRef<const FGenCompiledSchema>> ByName;
+	TMap<TWeakObjectPtr<const UScriptStruct>, TSharedRef<const FGenCompiledSchema>> ByStruct;
+	TMap<FString, TSharedRef<const FGenCompiledSchema>> ByJson;
+	TArray<UScriptStruct* (*)()> PendingStructs;
+};
+
+struct FGenSchemaAutoRegister
+{
+	explicit FGenSchemaAutoRegister(UScriptStruct* (*GetStruct)())
+	{
+		FGenSchemaRegistry::Get().AddPendingStruct(GetStruct);
+	}
+};
+
+// Caches the schema of a USTRUCT when the engine has started, use it once in a .cpp file
+#define GENAI_REGISTER_SCHEMA(StructType) \
+	static FGenSchemaAutoRegister PREPROCESSOR_JOIN(GenSchemaAutoRegister_, __LINE__)([]() -> UScriptStruct* { return StructType::StaticStruct(); });
+
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenSchemaLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Makes SchemaJson available to structured requests by Name, false with the reason in the log if it is not a valid schema
+	UFUNCTION(BlueprintCallable, Category = "GenAI|Structured")
+	static bool RegisterSchema(FName Name, const FString& SchemaJson);
+
+	// JSON schema derived from the struct's properties
+	UFUNCTION(BlueprintPure, Category = "GenAI|Structured")
+	static FString MakeSchemaFromStruct(const UScriptStruct* Struct);
+};
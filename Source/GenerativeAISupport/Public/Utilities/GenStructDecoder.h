@@ -0,0 +1,33 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Decodes JSON straight into a USTRUCT with FGenJsonPullReader, without building a DOM or walking the struct's
+ * reflection data on every call. Each struct's field map (key, offset and decode function per property) is built the
+ * first time the struct is decoded and cached from then on.
+ * Keys are matched the way FGenSchemaRegistry names them and FJsonObjectConverter reads them, case insensitively.
+ * Supports the property types FGenSchemaRegistry derives schemas for: bool, numbers, enums (by name or value), strings,
+ * names, texts, nested structs, arrays and sets. Keys without a matching property are skipped, properties without a
+ * matching key keep their value. Thread safe.
+ */
+class GENERATIVEAISUPPORT_API FGenStructDecoder
+{
+public:
+	// Fills Data, an instance of Struct, from a UTF-8 JSON object
+	static bool Decode(const UScriptStruct* Struct, void* Data, TConstArrayView<uint8> Utf8Json, FString* OutError = nullptr);
+	static bool Decode(const UScriptStruct* Struct, void* Data, FStringView Json, FString* OutError = nullptr);
+
+	template <typename TStruct>
+	static bool Decode(FStringView Json, TStruct& OutValue, FString* OutError = nullptr)
+	{
+		return Decode(TStruct::StaticStruct(), &OutValue, Json, OutError);
+	}
+
+	// Builds the field map of Struct ahead of the first decode
+	static void Prepare(const UScriptStruct* Struct);
+};
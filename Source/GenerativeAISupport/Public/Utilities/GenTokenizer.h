@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/OpenAI/GenOAIChatStructs.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GenTokenizer.generated.h"
+
+UENUM(BlueprintType)
+enum class EGenTokenizerEncoding : uint8
+{
+	// gpt-4, gpt-3.5-turbo and the text-embedding models
+	CL100K UMETA(DisplayName = "cl100k_base"),
+	// gpt-4o, gpt-4.1, gpt-5 and the o-series, also the closest public match for Claude, Grok and DeepSeek
+	O200K UMETA(DisplayName = "o200k_base")
+};
+
+/**
+ * Byte pair encoding tokenizer for tiktoken vocab files ("<base64 token> <rank>" per line), loaded from
+ * Content/Tokenizers/<encoding>.tiktoken of the plugin, e.g. Content/Tokenizers/o200k_base.tiktoken.
+ *
+ * Text is split with a hand written scanner following the encodings' split patterns, then every piece is looked up
+ * whole and only merged pair by pair when it is not a token itself. Letter and case classes are exact for ASCII,
+ * Latin, Greek and Cyrillic and approximated by ranges elsewhere, counts for other scripts may be off by a few percent.
+ * A loaded tokenizer is immutable and can be used from any thread.
+ */
+class GENERATIVEAISUPPORT_API FGenTokenizer
+{
+public:
+	// Loads the vocab on first use, nullptr when the file is missing or invalid
+	static const FGenTokenizer* Get(EGenTokenizerEncoding Encoding);
+
+	static EGenTokenizerEncoding GetEncodingForModel(const FString& Model);
+
+	static const TCHAR* GetEncodingName(EGenTokenizerEncoding Encoding);
+
+	// Token count of Text, or the usual four characters per token when the vocab is not available
+	static int32 CountTokensOrEstimate(EGenTokenizerEncoding Encoding, FStringView Text);
+
+	// Prompt tokens of a chat request, including the few tokens of framing OpenAI adds per message and for the reply
+	static int32 CountChatTokensOrEstimate(EGenTokenizerEncoding Encoding, TConstArrayView<FGenChatMessage> Messages);
+
+	bool LoadFromFile(const FString& FilePath, EGenTokenizerEncoding InEncoding);
+
+	int32 CountTokens(FStringView Text) const;
+	int32 CountTokensUtf8(TConstArrayView<uint8> Utf8) const;
+
+	void Encode(FStringView Text, TArray<int32>& OutTokens) const;
+	FString Decode(TConstArrayView<int32> Tokens) const;
+
+	// Longest prefix of Text that encodes to at most MaxTokens tokens, never cut inside a character
+	FString Truncate(FStringView Text, int32 MaxTokens) const;
+
+	int32 GetVocabSize() const { return Entries.Num(); }
+
+	// Visits every token of Utf8 in order with its rank and the byte offset it ends at, return false to stop
+	void EncodeUtf8(TConstArrayView<uint8> Utf8, TFunctionRef<bool(int32 Rank, int32 EndOffset)> OnToken) const;
+
+	// Per message and reply priming overhead of the chat format, see CountChatTokensOrEstimate
+	static constexpr int32 TokensPerMessage = 3;
+	static constexpr int32 TokensPerReply = 3;
+
+private:
+	struct FEntry
+	{
+		int32 Offset = 0;
+		int32 Length = 0;
+	};
+
+	int32 FindRank(const uint8* Data, int32 Length) const;
+
+	// Returns false once OnToken asked to stop
+	bool EncodePiece(const uint8* Data, int32 Length, int32 PieceOffset, TFunctionRef<bool(int32 Rank, int32 EndOffset)> OnToken) const;
+
+	EGenTokenizerEncoding Encoding = EGenTokenizerEncoding::O200K;
+
+	// Token bytes back to back, Entries indexes them by rank
+	TArray<uint8> TokenBytes;
+	TArray<FEntry> Entries;
+
+	// Open addressing table of ranks keyed by token bytes, INDEX_NONE marks a free slot
+	TArray<int32> Slots;
+	uint32 SlotMask = 0;
+
+	int32 ByteRanks[256];
+};
+
+UCLASS()
+class GENERATIVEAISUPPORT_API UGenTokenizerLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Falls back to four characters per token when the vocab file is missing
+	UFUNCTION(BlueprintPure, Category = "GenAI|Tokenizer")
+	static int32 CountTokens(const FString& Text, EGenTokenizerEncoding Encoding = EGenTokenizerEncoding::O200K);
+
+	// Picks the encoding from the model name, e.g. "gpt-4o-mini"
+	UFUNCTION(BlueprintPure, Category = "GenAI|Tokenizer")
+	static int32 CountTokensForModel(const FString& Text, const FString& Model);
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Tokenizer")
+	static int32 CountChatTokens(const TArray<FGenChatMessage>& Messages, EGenTokenizerEncoding Encoding = EGenTokenizerEncoding::O200K);
+
+	// Cuts at four characters per token when the vocab file is missing
+	UFUNCTION(BlueprintPure, Category = "GenAI|Tokenizer")
+	static FString TruncateToTokens(const FString& Text, int32 MaxTokens, EGenTokenizerEncoding Encoding = EGenTokenizerEncoding::O200K);
+
+	UFUNCTION(BlueprintPure, Category = "GenAI|Tokenizer")
+	static bool IsTokenizerAvailable(EGenTokenizerEncoding Encoding);
+};
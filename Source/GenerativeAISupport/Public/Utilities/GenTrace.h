@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Prajwal Shetty. All rights reserved.
+// Licensed under the MIT License. See LICENSE file in the root directory of this
+// source tree or http://opensource.org/licenses/MIT.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ * Unreal Insights instrumentation of the plugin, runtime and editor module alike.
+ * CPU scopes go to the "GenAI" channel, capture them with -trace=default,GenAI or "Trace.Enable GenAI" at runtime.
+ * Counters (GenAI/...) and one timing region per provider request ("GenAI <Provider> <Model> #<Id>", from submit to result)
+ * are recorded alongside, the regions only while the channel is enabled.
+ */
+UE_TRACE_CHANNEL_EXTERN(GenAIChannel, GENERATIVEAISUPPORT_API);
+
+#define GENAI_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, GenAIChannel)
+
+class GENERATIVEAISUPPORT_API FGenTrace
+{
+public:
+	static void RequestQueued();
+	static void RequestDequeued();
+	static void RequestSent();
+	static void RequestFinished();
+
+	static void AddBytesSent(int64 Bytes);
+	static void AddBytesReceived(int64 Bytes);
+	static void CacheHit();
+	static void RequestCoalesced();
+
+	// Empty when the channel is off, EndRequestRegion ignores empty names
+	static FString BeginRequestRegion(const TCHAR* ProviderName, const FString& Model);
+	static void EndRequestRegion(FString& Region);
+};
@@ -28,6 +28,7 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "UObject/UnrealTypePrivate.h"
+#include "Utilities/GenTrace.h"
 
 
 TMap<FString, FString> UGenBlueprintNodeCreator::NodeTypeMap;
@@ -38,6 +39,7 @@ FString UGenBlueprintNodeCreator::AddNode(const FString& BlueprintPath, const FS
                                           const FString& NodeType, float NodeX, float NodeY,
                                           const FString& PropertiesJson, bool bFinalizeChanges)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::AddNode");
 	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
 	if (!Blueprint)
 	{
@@ -162,6 +164,7 @@ FString UGenBlueprintNodeCreator::AddNode(const FString& BlueprintPath, const FS
 FString UGenBlueprintNodeCreator::AddNodesBulk(const FString& BlueprintPath, const FString& FunctionGuid,
                                                const FString& NodesJson)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::AddNodesBulk");
 	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
 	if (!Blueprint)
 	{
@@ -273,6 +276,7 @@ FString UGenBlueprintNodeCreator::AddNodesBulk(const FString& BlueprintPath, con
 bool UGenBlueprintNodeCreator::DeleteNode(const FString& BlueprintPath, const FString& FunctionGuid,
                                           const FString& NodeGuid)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::DeleteNode");
 	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
 	if (!Blueprint)
 	{
@@ -350,6 +354,7 @@ bool UGenBlueprintNodeCreator::DeleteNode(const FString& BlueprintPath, const FS
 // Get all nodes in a graph with their positions
 FString UGenBlueprintNodeCreator::GetAllNodesInGraph(const FString& BlueprintPath, const FString& FunctionGuid)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::GetAllNodesInGraph");
 	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
 	if (!Blueprint) return TEXT("");
 
@@ -859,6 +864,7 @@ FString UGenBlueprintNodeCreator::TryCreateNodeFromLibraries(UEdGraph* Graph, co
                                                              UK2Node*& OutNode,
                                                              TArray<FString>& OutSuggestions)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::TryCreateNodeFromLibraries");
 	static const TArray<FString> CommonLibraries = {
 		TEXT("KismetMathLibrary"), TEXT("KismetSystemLibrary"), TEXT("KismetStringLibrary"),
 		TEXT("KismetArrayLibrary"), TEXT("KismetTextLibrary"), TEXT("GameplayStatics"),
@@ -992,6 +998,7 @@ bool UGenBlueprintNodeCreator::CreateMathFunctionNode(UEdGraph* Graph, const FSt
 
 FString UGenBlueprintNodeCreator::GetNodeSuggestions(const FString& NodeType)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::GetNodeSuggestions");
 	static const TArray<FString> CommonLibraries = {
 		TEXT("KismetMathLibrary"), TEXT("KismetSystemLibrary"), TEXT("KismetStringLibrary"),
 		TEXT("KismetArrayLibrary"), TEXT("KismetTextLibrary"), TEXT("GameplayStatics"),
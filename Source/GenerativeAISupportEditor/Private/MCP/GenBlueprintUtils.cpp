@@ -23,10 +23,12 @@
 #include "Engine/SimpleConstructionScript.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "Utilities/GenTrace.h"
 
 UBlueprint* UGenBlueprintUtils::CreateBlueprint(const FString& BlueprintName, const FString& ParentClassName,
                                                 const FString& SavePath)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::CreateBlueprint");
 	// Find parent class
 	UClass* ParentClass = FindClassByName(ParentClassName);
 	if (!ParentClass)
@@ -100,6 +102,7 @@ UBlueprint* UGenBlueprintUtils::CreateBlueprint(const FString& BlueprintName, co
 bool UGenBlueprintUtils::AddComponent(const FString& BlueprintPath, const FString& ComponentClass,
                                       const FString& ComponentName)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::AddComponent");
 	// Load the blueprint asset
 	UBlueprint* Blueprint = LoadBlueprintAsset(BlueprintPath);
 	if (!Blueprint)
@@ -163,6 +166,7 @@ bool UGenBlueprintUtils::AddVariable(const FString& BlueprintPath, const FString
                                      const FString& VariableType, const FString& DefaultValue,
                                      const FString& Category)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::AddVariable");
 	// Load the blueprint asset
 	UBlueprint* Blueprint = LoadBlueprintAsset(BlueprintPath);
 	if (!Blueprint)
@@ -306,6 +310,7 @@ bool UGenBlueprintUtils::AddVariable(const FString& BlueprintPath, const FString
 FString UGenBlueprintUtils::AddFunction(const FString& BlueprintPath, const FString& FunctionName,
                                         const FString& InputsJson, const FString& OutputsJson)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::AddFunction");
 	// Load the blueprint asset
 	UBlueprint* Blueprint = LoadBlueprintAsset(BlueprintPath);
 	if (!Blueprint)
@@ -494,6 +499,7 @@ FString UGenBlueprintUtils::ConnectNodes(const FString& BlueprintPath, const FSt
                                          const FString& SourceNodeGuid, const FString& SourcePinName,
                                          const FString& TargetNodeGuid, const FString& TargetPinName)
 {
+    GENAI_TRACE_SCOPE("GenAI::MCP::ConnectNodes");
     UBlueprint* Blueprint = LoadBlueprintAsset(BlueprintPath);
     if (!Blueprint) return TEXT("{\"success\": false, \"error\": \"Could not load blueprint\"}");
 
@@ -633,6 +639,7 @@ FString UGenBlueprintUtils::ConnectNodes(const FString& BlueprintPath, const FSt
 
 bool UGenBlueprintUtils::CompileBlueprint(const FString& BlueprintPath)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::CompileBlueprint");
 	UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
 	if (!Blueprint) return false;
     
@@ -685,6 +692,7 @@ AActor* UGenBlueprintUtils::SpawnBlueprint(const FString& BlueprintPath, const F
                                            const FRotator& Rotation, const FVector& Scale,
                                            const FString& ActorLabel)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::SpawnBlueprint");
 	// Load the blueprint asset
 	UBlueprint* Blueprint = LoadBlueprintAsset(BlueprintPath);
 	if (!Blueprint)
@@ -770,6 +778,7 @@ UFunction* UGenBlueprintUtils::FindFunctionByName(UClass* Class, const FString&
 FString UGenBlueprintUtils::ConnectNodesBulk(const FString& BlueprintPath, const FString& FunctionGuid,
                                              const FString& ConnectionsJson)
 {
+    GENAI_TRACE_SCOPE("GenAI::MCP::ConnectNodesBulk");
     // Load the blueprint asset
     UBlueprint* Blueprint = LoadBlueprintAsset(BlueprintPath);
     if (!Blueprint)
@@ -866,6 +875,7 @@ FString UGenBlueprintUtils::ConnectNodesBulk(const FString& BlueprintPath, const
 
 bool UGenBlueprintUtils::OpenBlueprintGraph(UBlueprint* Blueprint, UEdGraph* Graph)
 {
+	GENAI_TRACE_SCOPE("GenAI::MCP::OpenBlueprintGraph");
 	if (!Blueprint || !GEditor)
 		return false;
         
@@ -959,6 +969,7 @@ bool UGenBlueprintUtils::OpenBlueprintGraph(UBlueprint* Blueprint, UEdGraph* Gra
 FString UGenBlueprintUtils::GetNodeGUID(const FString& BlueprintPath, const FString& GraphType, 
                                         const FString& NodeName, const FString& FunctionGuid)
 {
+    GENAI_TRACE_SCOPE("GenAI::MCP::GetNodeGUID");
     UBlueprint* Blueprint = LoadBlueprintAsset(BlueprintPath);
     if (!Blueprint) return TEXT("{\"success\": false, \"error\": \"Could not load blueprint\"}");
 
@@ -1072,6 +1083,7 @@ FString UGenBlueprintUtils::GetNodeGUID(const FString& BlueprintPath, const FStr
 
 FString UGenBlueprintUtils::AddComponentWithEvents(const FString& BlueprintPath, const FString& ComponentName, const FString& ComponentClassName)
 {
+    GENAI_TRACE_SCOPE("GenAI::MCP::AddComponentWithEvents");
     // Load the Blueprint
     UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
     if (!Blueprint)